@@ -0,0 +1,40 @@
+/*
+** EPITECH PROJECT, 2025
+** admin.h
+** File description:
+** admin socket requests handed to the simulation thread
+*/
+
+#ifndef ADMIN_H_
+    #define ADMIN_H_
+    #include <pthread.h>
+    #include <stdatomic.h>
+    #include <stdbool.h>
+    #include <stdio.h>
+    #define ADMIN_LINE 256
+    #define ADMIN_QUEUE 16
+    #define ADMIN_WAIT_MS 200
+
+typedef struct {
+    char line[ADMIN_LINE];
+    char *reply;
+    size_t len;
+    bool done;
+} admin_request_t;
+
+/*
+** The admin thread queues a request and waits on done; the simulation
+** loop only takes lock with a trylock once pending is non zero, runs
+** the requests and signals back. paused and steps belong to the
+** simulation thread.
+*/
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t done;
+    admin_request_t *queue[ADMIN_QUEUE];
+    int count;
+    atomic_int pending;
+    bool paused;
+    int steps;
+} admin_control_t;
+#endif /* !ADMIN_H_ */
@@ -0,0 +1,25 @@
+/*
+** EPITECH PROJECT, 2025
+** admin_commands.h
+** File description:
+** commands of the admin control socket
+*/
+
+#ifndef ADMIN_COMMANDS_H_
+    #define ADMIN_COMMANDS_H_
+    #include "server.h"
+
+typedef struct {
+    const char *name;
+    void (*handler)(server_t *server, FILE *out, const char *args);
+} admin_command_t;
+
+void admin_cmd_step(server_t *server, FILE *out, const char *args);
+void admin_cmd_freq(server_t *server, FILE *out, const char *args);
+void admin_cmd_status(server_t *server, FILE *out, const char *args);
+void admin_cmd_respawn(server_t *server, FILE *out, const char *args);
+void admin_cmd_queue(server_t *server, FILE *out, const char *args);
+void admin_cmd_clients(server_t *server, FILE *out, const char *args);
+void admin_cmd_snapshot(server_t *server, FILE *out, const char *args);
+void admin_cmd_checkpoint(server_t *server, FILE *out, const char *args);
+#endif /* !ADMIN_COMMANDS_H_ */
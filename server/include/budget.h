@@ -0,0 +1,56 @@
+/*
+** EPITECH PROJECT, 2025
+** budget.h
+** File description:
+** tick budget controller and load shedding levels
+*/
+
+#ifndef BUDGET_H_
+    #define BUDGET_H_
+    #include <stdbool.h>
+    #include <stdint.h>
+    #define BUDGET_HIGH_PERMILLE 900
+    #define BUDGET_LOW_PERMILLE 600
+    #define BUDGET_HOLD_TICKS 10
+    #define BUDGET_CALM_TICKS 50
+    #define BUDGET_CONFLATE_TICKS 4
+
+typedef enum {
+    BUDGET_IO,
+    BUDGET_SIM,
+    BUDGET_PUBLISH,
+    BUDGET_PHASES
+} budget_phase_t;
+
+/*
+** Each level keeps the ones below it: respawn is spread over the cycle,
+** then bct updates are conflated, then logging drops to warnings.
+** Action completion, deaths and replies are never deferred.
+*/
+typedef enum {
+    SHED_NONE,
+    SHED_RESPAWN,
+    SHED_GUI,
+    SHED_LOG,
+    SHED_LEVELS
+} shed_level_t;
+
+typedef struct {
+    int level;
+    int load_permille;
+    uint64_t phase_ns[BUDGET_PHASES];
+    uint64_t level_ticks[SHED_LEVELS];
+    uint64_t transitions;
+    uint64_t deferred_tiles;
+    uint64_t spread_ticks;
+} budget_stats_t;
+
+typedef struct {
+    uint64_t busy_ns[BUDGET_PHASES];
+    int hold;
+    int calm;
+    bool spreading;
+    int *pending;
+    int pending_nb;
+} budget_t;
+#endif /* !BUDGET_H_ */
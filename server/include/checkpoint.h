@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2025
+** checkpoint.h
+** File description:
+** world checkpoints written by a forked child, restored with mmap
+*/
+
+#ifndef CHECKPOINT_H_
+    #define CHECKPOINT_H_
+    #include <stdint.h>
+    #include <sys/types.h>
+    #include "client.h"
+    #include "map.h"
+    #define CHECKPOINT_MAGIC 0x504b435aU
+    #define CHECKPOINT_VERSION 1
+    #define CHECKPOINT_TICKS 1000
+    #define CHECKPOINT_NAME 64
+    #define CHECKPOINT_SIDE_MAX 65536
+    #define CHECKPOINT_TEAMS_MAX 1024
+    #define CHECKPOINT_LEVEL_MAX 8
+    #define CHECKPOINT_ALIGN(size) (((size) + 7) & ~(uint64_t)7)
+
+/*
+** Layout: header | tiles[width * height] | teams[team_nb]
+** | players[player_count] | actions[action_nb], each section 8-byte
+** aligned at the offset stored in the header. Players keep their slot
+** in server->players; their actions follow in queue order.
+*/
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t header_size;
+    int32_t width;
+    int32_t height;
+    int32_t team_nb;
+    int32_t player_nb;
+    int32_t player_count;
+    int32_t action_nb;
+    uint64_t tick;
+    uint64_t seed;
+    rng_t rng[RNG_STREAMS];
+    uint64_t tiles;
+    uint64_t teams;
+    uint64_t players;
+    uint64_t actions;
+    uint64_t size;
+} checkpoint_header_t;
+
+typedef struct {
+    int32_t resources[RESOURCE_COUNT];
+} checkpoint_tile_t;
+
+typedef struct {
+    char name[CHECKPOINT_NAME];
+    int32_t max_players;
+    int32_t actual_players;
+    int32_t eggs_available;
+} checkpoint_team_t;
+
+typedef struct {
+    int32_t slot;
+    int32_t id;
+    int32_t x;
+    int32_t y;
+    int32_t lvl;
+    int32_t dir;
+    int32_t life_remain;
+    int32_t food_tick;
+    int32_t action_nb;
+    int32_t inventory[RESOURCE_COUNT];
+    char team[CHECKPOINT_NAME];
+} checkpoint_player_t;
+
+typedef struct {
+    int32_t remaining_ticks;
+    int32_t ticks;
+    char command[BUF_SIZE];
+} checkpoint_action_t;
+
+typedef struct {
+    const char *path;
+    pid_t pid;
+    uint64_t start_ns;
+    unsigned long tick;
+    unsigned long next_tick;
+} checkpoint_t;
+
+void checkpoint_layout(checkpoint_header_t *header);
+bool checkpoint_records_valid(const char *base);
+#endif /* !CHECKPOINT_H_ */
@@ -8,6 +8,7 @@
 #ifndef CLIENT_H_
     #define CLIENT_H_
     #define BUF_SIZE 1024
+    #define NB_CONNECTION 12
     #include "player.h"
 
 typedef enum {
@@ -16,12 +17,23 @@ typedef enum {
     CLIENT_GUI
 } client_type_t;
 
+typedef struct {
+    int x;
+    int y;
+    int width;
+    int height;
+    int margin;
+    bool active;
+} gui_view_t;
+
 typedef struct {
     int fd;
     char read_buf[BUF_SIZE];
     int read_len;
+    uint64_t read_ns;
     client_type_t type;
     player_t *player;
+    gui_view_t view;
 } client_t;
 
 #endif /* !CLIENT_H_ */
@@ -25,6 +25,7 @@
     #define CMD_TAKE_TIME 7
     #define CMD_SET_TIME 7
     #define CMD_INCANTATION_TIME 300
+    #define CMD_IDLE_TIME 1
 
 typedef struct {
     char *name;
@@ -80,6 +81,7 @@ void cmd_eject(server_t *server, player_t *player);
 void cmd_take(server_t *server, player_t *player, char *args);
 void cmd_set(server_t *server, player_t *player, char *args);
 void cmd_incantation(server_t *server, player_t *player);
+void cmd_idle(server_t *server, player_t *player);
 
 void execute_command(server_t *server, player_t *player, char *command);
 void process_completed_actions(server_t *server);
@@ -134,7 +136,8 @@ void execute_movement_and_info_commands(server_t *server, player_t *player,
     const char *cmd_name, const char *safe_args);
 void handle_movement_commands(player_t *player, const char *cmd_name,
     const char *original_command);
-void handle_graphic_client_registration(server_t *server, int i);
+void handle_graphic_client_registration(server_t *server, int i,
+    const char *buffer);
 void handle_team_command(server_t *server, server_config_t *config,
     int client_index, const char *buffer);
 void process_new_connections(server_t *server);
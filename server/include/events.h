@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2025
+** events.h
+** File description:
+** typed game events batched per loop iteration
+*/
+
+#ifndef EVENTS_H_
+    #define EVENTS_H_
+    #include <stddef.h>
+    #include <stdint.h>
+    #include "map.h"
+    #define EVENT_SINKS 8
+    #define EVENT_NO_TEXT UINT32_MAX
+    #define EVENT_INITIAL 256
+    #define EVENT_TEXT_INITIAL 4096
+    #define EVENT_TO_ALL 1
+    #define EVENT_TO_TILE 2
+    #define EVENT_TO_MOVE 4
+    #define EVENT_TO_SHM 8
+
+typedef enum {
+    EVENT_PNW,
+    EVENT_PPO,
+    EVENT_PLV,
+    EVENT_PIN,
+    EVENT_BCT,
+    EVENT_PEX,
+    EVENT_PBC,
+    EVENT_PIC,
+    EVENT_PIE,
+    EVENT_PFK,
+    EVENT_PDR,
+    EVENT_PGT,
+    EVENT_PDI,
+    EVENT_SST,
+    EVENT_TYPES
+} event_type_t;
+
+/*
+** Values are copied at publish time: a player may die and be freed
+** before the batch is flushed. Strings live in the bus text arena.
+*/
+typedef struct {
+    uint8_t type;
+    int32_t id;
+    int32_t x;
+    int32_t y;
+    int32_t old_x;
+    int32_t old_y;
+    int32_t dir;
+    int32_t level;
+    int32_t value;
+    uint32_t text;
+    int32_t items[RESOURCE_COUNT];
+} event_t;
+
+typedef void (*event_sink_t)(void *ctx, const event_t *events,
+    size_t count, const char *text);
+
+typedef struct {
+    event_t *events;
+    size_t count;
+    size_t capacity;
+    char *text;
+    size_t text_len;
+    size_t text_cap;
+    event_sink_t sinks[EVENT_SINKS];
+    void *ctx[EVENT_SINKS];
+    int sink_nb;
+} event_bus_t;
+
+event_t *event_bus_push(event_bus_t *bus, int type);
+uint32_t event_bus_text(event_bus_t *bus, const char *str);
+int event_bus_subscribe(event_bus_t *bus, event_sink_t sink, void *ctx);
+void event_bus_flush(event_bus_t *bus);
+void event_bus_free(event_bus_t *bus);
+const char *event_name(int type);
+int event_route(int type);
+int event_encode_text(char *buf, size_t size, const event_t *event,
+    const char *text);
+void event_fill_tile(event_t *event, const map_t *map, int x, int y);
+#endif /* !EVENTS_H_ */
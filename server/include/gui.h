@@ -0,0 +1,45 @@
+/*
+** EPITECH PROJECT, 2025
+** gui.h
+** File description:
+** GUI fan-out and viewport subscriptions
+*/
+
+#ifndef GUI_H_
+    #define GUI_H_
+    #include "server.h"
+    #define GUI_LINE_SIZE 1024
+
+typedef struct {
+    const char *name;
+    void (*handler)(server_t *server, int i, const char *args);
+} gui_command_t;
+
+unsigned int interest_mask_at(server_t *server, int x, int y);
+void send_gui_mask(server_t *server, unsigned int mask, const char *line);
+void send_gui_tile_content(server_t *server, int x, int y);
+void gui_subscribe_view(server_t *server, int i, gui_view_t view);
+void gui_unsubscribe_view(server_t *server, int i);
+void send_cell_snapshot(server_t *server, int i, int col, int row);
+void send_cell_exit(server_t *server, int i, int col, int row);
+bool parse_view_command(const char *args, gui_view_t *view);
+int format_bct(char *buf, map_t *map, int x, int y);
+void send_map_content_to_gui(int gui_fd, map_t *map);
+int format_pin(char *buf, player_t *player);
+int format_ppo(char *buf, player_t *player);
+void send_player_to_gui(server_t *server, player_t *player);
+void handle_gui_command(server_t *server, int i, const char *buffer);
+void gui_cmd_rsh(server_t *server, int i, const char *args);
+void send_resync_header(server_t *server, int gui_fd,
+    server_config_t *config);
+void send_mct(server_t *server, int fd);
+void gui_cmd_msz(server_t *server, int i, const char *args);
+void gui_cmd_bct(server_t *server, int i, const char *args);
+void gui_cmd_mct(server_t *server, int i, const char *args);
+void gui_cmd_sgt(server_t *server, int i, const char *args);
+void gui_cmd_sst(server_t *server, int i, const char *args);
+void gui_cmd_tna(server_t *server, int i, const char *args);
+void gui_cmd_ppo(server_t *server, int i, const char *args);
+void gui_cmd_plv(server_t *server, int i, const char *args);
+void gui_cmd_pin(server_t *server, int i, const char *args);
+#endif /* !GUI_H_ */
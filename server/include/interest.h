@@ -0,0 +1,21 @@
+/*
+** EPITECH PROJECT, 2025
+** interest.h
+** File description:
+** spatial interest grid for GUI viewports
+*/
+
+#ifndef INTEREST_H_
+    #define INTEREST_H_
+    #define INTEREST_CELL 8
+
+typedef struct {
+    int cols;
+    int rows;
+    unsigned int *masks;
+    unsigned int global_mask;
+} interest_grid_t;
+
+void init_interest(interest_grid_t *grid, int width, int height);
+void free_interest(interest_grid_t *grid);
+#endif /* !INTEREST_H_ */
@@ -0,0 +1,94 @@
+/*
+** EPITECH PROJECT, 2025
+** journal.h
+** File description:
+** append-only binary game journal and its tick index
+*/
+
+#ifndef JOURNAL_H_
+    #define JOURNAL_H_
+    #include <pthread.h>
+    #include <stdatomic.h>
+    #include <stdbool.h>
+    #include <stdint.h>
+    #include <stdio.h>
+    #include "events.h"
+    #define JOURNAL_MAGIC 0x314e524aU
+    #define JOURNAL_VERSION 1
+    #define JOURNAL_CHUNK (64UL << 20)
+    #define JOURNAL_RING_MIN (4UL << 20)
+    #define JOURNAL_KEYFRAME_TICKS 1000
+    #define JOURNAL_INDEX_TICKS 100
+    #define JOURNAL_KEYFRAME 0xff
+    #define JOURNAL_DIGEST 0xfe
+    #define JOURNAL_INDEX_KEYFRAME 1
+    #define JOURNAL_TEXT_MAX 255
+    #define JOURNAL_RECORD_MAX (20 + 28 + JOURNAL_TEXT_MAX + 4)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    int32_t width;
+    int32_t height;
+    int32_t freq;
+    uint32_t keyframe_ticks;
+    uint32_t index_ticks;
+    uint32_t header_size;
+} journal_header_t;
+
+/*
+** Fixed 20-byte head. PIN / BCT records are followed by the seven
+** resource counts, text records by text_len bytes; size includes both
+** and is a multiple of 4. value holds the level for pnw / plv / pic.
+*/
+typedef struct {
+    uint16_t size;
+    uint8_t type;
+    uint8_t dir;
+    uint32_t tick;
+    int32_t id;
+    int16_t x;
+    int16_t y;
+    int32_t value;
+} journal_record_t;
+
+typedef struct {
+    uint32_t tick;
+    uint32_t flags;
+    uint64_t offset;
+} journal_index_t;
+
+/*
+** The simulation thread appends records to ring and never blocks: a
+** record that does not fit is dropped and counted. The writer thread
+** copies the ring into the mapped file and writes the .idx sidecar.
+*/
+typedef struct {
+    int fd;
+    FILE *index;
+    char *map;
+    size_t mapped;
+    size_t length;
+    size_t scanned;
+    uint32_t next_index;
+    uint8_t *ring;
+    size_t ring_size;
+    atomic_size_t head;
+    atomic_size_t tail;
+    atomic_bool running;
+    atomic_ulong dropped;
+    pthread_t thread;
+    unsigned long next_keyframe;
+    unsigned long digest_tick;
+} journal_t;
+
+bool journal_has_items(int type);
+size_t journal_encode(uint8_t *buf, const event_t *event, const char *text,
+    uint32_t tick);
+const char *journal_decode(const journal_record_t *record, event_t *event);
+bool journal_has_text(int type);
+void *journal_writer(void *arg);
+bool journal_append(journal_t *journal, const void *data, size_t size);
+void journal_write_event(journal_t *journal, const event_t *event,
+    const char *text, unsigned long tick);
+#endif /* !JOURNAL_H_ */
@@ -0,0 +1,78 @@
+/*
+** EPITECH PROJECT, 2025
+** log.h
+** File description:
+** leveled asynchronous logger
+*/
+
+#ifndef LOG_H_
+    #define LOG_H_
+    #include <stdatomic.h>
+    #include <stdbool.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #define LOG_RING_SIZE 2048
+    #define LOG_MAX_ARGS 8
+    #define LOG_TEXT_SIZE 96
+    #define LOG_LINE_SIZE 512
+    #ifndef LOG_COMPILE_LEVEL
+        #define LOG_COMPILE_LEVEL LOG_TRACE
+    #endif
+    #define LOG_ON(lvl) ((lvl) >= LOG_COMPILE_LEVEL && log_enabled(lvl))
+    #define LOG_AT(l, ...) (LOG_ON(l) ? log_write(l, __VA_ARGS__) : (void)0)
+    #define log_trace(...) LOG_AT(LOG_TRACE, __VA_ARGS__)
+    #define log_debug(...) LOG_AT(LOG_DEBUG, __VA_ARGS__)
+    #define log_info(...) LOG_AT(LOG_INFO, __VA_ARGS__)
+    #define log_warn(...) LOG_AT(LOG_WARN, __VA_ARGS__)
+    #define log_error(...) LOG_AT(LOG_ERROR, __VA_ARGS__)
+
+typedef enum {
+    LOG_TRACE = 0,
+    LOG_DEBUG,
+    LOG_INFO,
+    LOG_WARN,
+    LOG_ERROR,
+    LOG_OFF
+} log_level_t;
+
+typedef union {
+    long long i;
+    unsigned long long u;
+    double f;
+    const void *p;
+    size_t offset;
+} log_arg_t;
+
+/*
+** One ring slot. Arguments are stored raw and %s strings are copied into
+** text; the drain thread re-walks fmt to render the line.
+*/
+typedef struct {
+    atomic_size_t seq;
+    uint64_t time_ns;
+    const char *fmt;
+    int level;
+    log_arg_t args[LOG_MAX_ARGS];
+    char text[LOG_TEXT_SIZE];
+} log_record_t;
+
+extern __thread int log_floor;
+
+int log_init(log_level_t level, const char *path);
+void log_shutdown(void);
+void log_set_floor(log_level_t level);
+bool log_enabled(log_level_t level);
+int log_parse_level(const char *name);
+const char *log_level_name(int level);
+size_t log_dropped(void);
+const char *log_skip_spec(const char *spec);
+int log_count_long(const char *spec, const char *conv);
+void log_write(log_level_t level, const char *fmt, ...)
+    __attribute__((format(printf, 2, 3)));
+void log_ring_init(void);
+log_record_t *log_ring_claim(void);
+void log_ring_commit(log_record_t *record);
+log_record_t *log_ring_peek(void);
+void log_ring_release(log_record_t *record);
+size_t log_render(const log_record_t *record, char *out, size_t size);
+#endif /* !LOG_H_ */
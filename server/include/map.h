@@ -8,6 +8,8 @@
 #ifndef MAP_H_
     #define MAP_H_
     #include <stdbool.h>
+    #include <stdint.h>
+    #include "rng.h"
 
 typedef enum {
     RESOURCE_INVALID = -1,
@@ -24,16 +26,29 @@ typedef enum {
 typedef struct {
     int resources[RESOURCE_COUNT];
     bool changed;
+    bool queued;
+    uint64_t hash;
 } tile_t;
 
+/*
+** Called for every cell a resource lands on while set, so callers that
+** keep derived state (region hashes, shm planes) can follow placements
+** without waiting for the changed-flag scan.
+*/
+typedef void (*map_touch_t)(void *ctx, int x, int y);
+
 typedef struct {
     int width;
     int height;
     tile_t **tiles;
+    map_touch_t touch;
+    void *touch_ctx;
 } map_t;
 
 float get_resource_density(resource_type_t type);
 void init_map(map_t *map, int width, int height);
-void generate_resources(map_t *map);
+void generate_resources(map_t *map, rng_t *rng);
 void free_map(map_t *map);
+void generate_resources_share(map_t *map, rng_t *rng, int part,
+    int parts);
 #endif /* !MAP_H_ */
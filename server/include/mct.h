@@ -0,0 +1,21 @@
+/*
+** EPITECH PROJECT, 2025
+** mct.h
+** File description:
+** per-row pre-encoded map content for mct queries
+*/
+
+#ifndef MCT_H_
+    #define MCT_H_
+    #include <stdbool.h>
+    #include <stddef.h>
+
+typedef struct {
+    int rows;
+    char **lines;
+    size_t *lens;
+    size_t *caps;
+    bool *dirty;
+} mct_cache_t;
+
+#endif /* !MCT_H_ */
@@ -0,0 +1,36 @@
+/*
+** EPITECH PROJECT, 2025
+** mem.h
+** File description:
+** allocation wrappers accounted per subsystem
+*/
+
+#ifndef MEM_H_
+    #define MEM_H_
+    #include <stddef.h>
+    #include <stdio.h>
+
+typedef enum {
+    MEM_MAP,
+    MEM_PLAYERS,
+    MEM_ACTIONS,
+    MEM_NETWORK,
+    MEM_RESPONSES,
+    MEM_GUI,
+    MEM_EVENTS,
+    MEM_TAGS
+} mem_tag_t;
+
+/*
+** Sizes come from malloc_usable_size, so a block must be released with
+** mem_free and the tag it was allocated with. Counters are relaxed
+** atomics: the admin thread may read them while the simulation runs.
+*/
+void *mem_alloc(mem_tag_t tag, size_t size);
+void *mem_calloc(mem_tag_t tag, size_t count, size_t size);
+void *mem_realloc(mem_tag_t tag, void *ptr, size_t size);
+void mem_free(mem_tag_t tag, void *ptr);
+char *mem_strdup(mem_tag_t tag, const char *str);
+void mem_write_prometheus(FILE *out);
+void mem_report(void);
+#endif /* !MEM_H_ */
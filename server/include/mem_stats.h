@@ -0,0 +1,22 @@
+/*
+** EPITECH PROJECT, 2025
+** mem_stats.h
+** File description:
+** counters behind the allocation wrappers
+*/
+
+#ifndef MEM_STATS_H_
+    #define MEM_STATS_H_
+    #include <stdatomic.h>
+    #include <stdint.h>
+    #include "mem.h"
+
+typedef struct {
+    _Atomic uint64_t live;
+    _Atomic uint64_t peak;
+    _Atomic uint64_t allocs;
+    _Atomic uint64_t frees;
+} mem_stats_t;
+
+extern mem_stats_t mem_stats[MEM_TAGS];
+#endif /* !MEM_STATS_H_ */
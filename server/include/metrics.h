@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2025
+** metrics.h
+** File description:
+** counters, HDR-style histograms and the admin socket
+*/
+
+#ifndef METRICS_H_
+    #define METRICS_H_
+    #include <pthread.h>
+    #include <stdatomic.h>
+    #include <stdbool.h>
+    #include <stdint.h>
+    #include <stdio.h>
+    #include "budget.h"
+    #include "client.h"
+    #include "events.h"
+    #define HIST_SUB_BITS 4
+    #define HIST_SUB (1 << HIST_SUB_BITS)
+    #define HIST_BUCKETS ((64 - HIST_SUB_BITS + 1) * HIST_SUB)
+    #define METRICS_COMMANDS 14
+    #define METRICS_SLOTS (NB_CONNECTION + 1)
+    #define METRICS_PUBLISH_NS 100000000ULL
+
+/*
+** Log-linear buckets: exact below HIST_SUB, then HIST_SUB sub-buckets per
+** power of two, so any recorded value is known within 1 / HIST_SUB.
+*/
+typedef struct {
+    uint64_t counts[HIST_BUCKETS];
+    uint64_t total;
+    uint64_t sum;
+    uint64_t max;
+} hist_t;
+
+typedef struct {
+    uint64_t commands[METRICS_COMMANDS];
+    uint64_t gui_commands;
+    uint64_t events[EVENT_TYPES];
+    uint64_t ticks;
+    uint64_t bytes_in;
+    uint64_t bytes_out;
+    uint64_t gui_lines;
+    uint64_t gui_bytes;
+    int64_t backlog[METRICS_SLOTS];
+    int slot_type[METRICS_SLOTS];
+    int players;
+    hist_t tick_ns;
+    hist_t tick_late_ns;
+    hist_t queue_depth;
+    hist_t gui_fanout_ns;
+    hist_t cmd_latency_ns[METRICS_COMMANDS];
+    hist_t cmd_overhead_ns[METRICS_COMMANDS];
+    budget_stats_t shed;
+} metrics_t;
+
+/*
+** live is written only by the simulation thread. It is copied into
+** snapshot under a trylock, so a reader holding the lock only delays
+** the next publish and never the tick.
+*/
+typedef struct {
+    metrics_t live;
+    metrics_t snapshot;
+    uint64_t acked[METRICS_SLOTS];
+    uint64_t published_ns;
+    pthread_mutex_t lock;
+    const char *path;
+    int fd;
+    pthread_t thread;
+    atomic_bool running;
+} metrics_registry_t;
+
+void hist_record(hist_t *hist, uint64_t value);
+uint64_t hist_bucket_low(int index);
+uint64_t hist_quantile(const hist_t *hist, double quantile);
+uint64_t hist_count_below(const hist_t *hist, uint64_t limit);
+uint64_t metrics_now_ns(void);
+const char *metrics_command_name(int index);
+void metrics_write_prometheus(FILE *out, const metrics_t *metrics);
+void metrics_write_counts(FILE *out, const metrics_t *metrics);
+void metrics_write_latency(FILE *out, const metrics_t *metrics);
+#endif /* !METRICS_H_ */
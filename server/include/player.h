@@ -26,6 +26,10 @@ typedef enum {
 typedef struct action_s {
     char *command;
     int remaining_ticks;
+    int ticks;
+    uint64_t read_ns;
+    uint64_t enqueue_ns;
+    uint64_t start_ns;
     struct action_s *next;
 } action_t;
 
@@ -41,8 +45,9 @@ typedef struct player_s {
     int life_remain;
     int food_tick;
     char *team;
+    uint64_t hash;
+    int region;
+    uint64_t read_ns;
 } player_t;
 
-player_t *create_player(int id, int fd, const char *team, map_t *map);
-
 #endif /* !PLAYER_H_ */
@@ -0,0 +1,23 @@
+/*
+** EPITECH PROJECT, 2025
+** probes.h
+** File description:
+** USDT probe points, compiled out unless built with USDT=1
+*/
+
+#ifndef PROBES_H_
+    #define PROBES_H_
+    #if defined(ZAPPY_USDT) && defined(__has_include)
+        #if __has_include(<sys/sdt.h>)
+            #include <sys/sdt.h>
+            #define ZAPPY_PROBE_ON
+        #else
+            #warning "USDT=1 but <sys/sdt.h> is missing, probes disabled"
+        #endif
+    #endif
+    #ifdef ZAPPY_PROBE_ON
+        #define ZAPPY_PROBE(...) STAP_PROBEV(zappy, __VA_ARGS__)
+    #else
+        #define ZAPPY_PROBE(...) ((void)0)
+    #endif
+#endif /* !PROBES_H_ */
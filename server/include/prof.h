@@ -0,0 +1,61 @@
+/*
+** EPITECH PROJECT, 2025
+** prof.h
+** File description:
+** scoped phase timers with Chrome trace and folded-stack export
+*/
+
+#ifndef PROF_H_
+    #define PROF_H_
+    #include <stdbool.h>
+    #include <stddef.h>
+    #include <stdint.h>
+    #define PROF_BUFFER_EVENTS (1 << 18)
+    #define PROF_MAX_DEPTH 32
+    #define PROF_CAT_(a, b) a##b
+    #define PROF_CAT(a, b) PROF_CAT_(a, b)
+    #define PROF_SCOPE(n) prof_scope_t PROF_CAT(prof_, __LINE__) \
+        __attribute__((cleanup(prof_end))) = prof_begin(n)
+    #define PROF_FUNC() PROF_SCOPE(__func__)
+
+typedef struct {
+    const char *name;
+    uint64_t start_ns;
+} prof_scope_t;
+
+typedef struct {
+    const char *name;
+    uint64_t start_ns;
+    uint64_t end_ns;
+} prof_event_t;
+
+/*
+** One buffer per recording thread, linked into a global list on first
+** use. Events are kept in a ring so a long game keeps its latest ticks.
+*/
+typedef struct prof_buffer_s {
+    int tid;
+    size_t count;
+    prof_event_t *events;
+    struct prof_buffer_s *next;
+} prof_buffer_t;
+
+typedef struct {
+    char *path;
+    uint64_t self_ns;
+} prof_folded_t;
+
+typedef struct {
+    prof_folded_t *entries;
+    size_t count;
+    size_t cap;
+} prof_folded_table_t;
+
+int prof_init(const char *path);
+void prof_shutdown(void);
+prof_scope_t prof_begin(const char *name);
+void prof_end(prof_scope_t *scope);
+size_t prof_sorted_events(prof_buffer_t *buffer, prof_event_t **out);
+int prof_write_chrome(const char *path, prof_buffer_t *buffers);
+int prof_write_folded(const char *path, prof_buffer_t *buffers);
+#endif /* !PROF_H_ */
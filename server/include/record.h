@@ -0,0 +1,28 @@
+/*
+** EPITECH PROJECT, 2025
+** record.h
+** File description:
+** input recording and replay
+*/
+
+#ifndef RECORD_H_
+    #define RECORD_H_
+    #define RECORD_MAGIC "zappy-record 1"
+    #define RECORD_HEADER_END "---"
+    #define RECORD_BUFFER (1 << 20)
+
+/*
+** One line per input: "<tick> <kind> <slot> <text>". tick is the tick
+** the input was handled at, before the next game tick; slot is the
+** client index (the new level for RECORD_SHED, -1 otherwise).
+*/
+typedef enum {
+    RECORD_CONNECT = 'c',
+    RECORD_MESSAGE = 'm',
+    RECORD_READ_CLOSED = 'd',
+    RECORD_HANGUP = 'h',
+    RECORD_ADMIN = 'a',
+    RECORD_SHED = 'l',
+    RECORD_END = 'e'
+} record_kind_t;
+#endif /* !RECORD_H_ */
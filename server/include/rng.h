@@ -0,0 +1,34 @@
+/*
+** EPITECH PROJECT, 2025
+** rng.h
+** File description:
+** seeded xoshiro256** streams, one per subsystem
+*/
+
+#ifndef RNG_H_
+    #define RNG_H_
+    #include <stddef.h>
+    #include <stdint.h>
+    #define RNG_BATCH 256
+
+/*
+** Each stream starts 2^128 draws after the previous one, so consuming
+** more from one (a respawn under load) never shifts another (spawns).
+*/
+typedef enum {
+    RNG_MAP,
+    RNG_RESPAWN,
+    RNG_SPAWN,
+    RNG_STREAMS
+} rng_stream_t;
+
+typedef struct {
+    uint64_t s[4];
+} rng_t;
+
+void rng_streams_init(rng_t *streams, int count, uint64_t seed);
+uint64_t rng_next(rng_t *rng);
+uint32_t rng_below(rng_t *rng, uint32_t bound);
+void rng_fill_below(rng_t *rng, uint32_t *out, size_t count,
+    uint32_t bound);
+#endif /* !RNG_H_ */
@@ -17,12 +17,28 @@
     #include "client.h"
     #include "player.h"
     #include "map.h"
+    #include "interest.h"
+    #include "sync.h"
+    #include "shm_world.h"
+    #include "mct.h"
+    #include "log.h"
+    #include "prof.h"
+    #include "metrics.h"
+    #include "probes.h"
+    #include "mem.h"
+    #include "events.h"
+    #include "journal.h"
+    #include "admin.h"
+    #include "record.h"
+    #include "checkpoint.h"
+    #include "warp.h"
 
-    #define NB_CONNECTION 12
     #define MAX_PLAYERS 130
     #define FD_NULL -1
     #define SUCCESS 0
     #define FAILURE 84
+    #define RESPAWN_TICKS 20
+    #define REPLY_LINE 4096
 
 typedef struct {
     int port;
@@ -34,8 +50,44 @@ typedef struct {
     int freq;
     int tick_freq;
     team_t *teams;
+    char *shm_name;
+    int log_level;
+    char *log_path;
+    char *prof_path;
+    char *admin_path;
+    char *journal_path;
+    uint64_t seed;
+    bool seeded;
+    char *record_path;
+    char *replay_path;
+    char *checkpoint_path;
+    char *restore_path;
+    bool headless;
+    bool warp;
+    int warp_cap;
+    int argc;
+    char **argv;
 } server_config_t;
 
+/*
+** Where player replies go when the world is embedded: without a sink
+** they are written to the player's descriptor.
+*/
+typedef void (*reply_fn_t)(void *ctx, int player, const char *line,
+    size_t len);
+
+typedef struct {
+    reply_fn_t fn;
+    void *ctx;
+} reply_sink_t;
+
+typedef struct {
+    const char *name;
+    void *base;
+    size_t size;
+    bool writing;
+} shm_world_t;
+
 typedef struct {
     int fd;
     int port;
@@ -49,12 +101,38 @@ typedef struct {
     client_t clients[NB_CONNECTION + 1];
     server_config_t *config;
     int gui_fd;
+    interest_grid_t interest;
+    sync_grid_t sync;
+    shm_world_t shm;
+    mct_cache_t mct;
+    unsigned long tick;
+    metrics_registry_t metrics;
+    budget_t budget;
+    event_bus_t events;
+    journal_t *journal;
+    admin_control_t admin;
+    rng_t rng[RNG_STREAMS];
+    FILE *record;
+    checkpoint_t checkpoint;
+    warp_t warp;
+    reply_sink_t reply;
 } server_t;
 
 void create_server(server_t *serv);
+int init_world(server_t *server, server_config_t *config);
+void cleanup_server(server_t *server);
+void free_world(server_t *server);
+void player_reply(server_t *server, player_t *player, const char *format,
+    ...);
+void add_client(int client_fd, server_t *server);
+void cleanup_disconnected_client(server_t *server, int i);
+void run_game_tick(server_t *server, int *tick_count);
+player_t *create_player(int id, int fd, const char *team, server_t *server);
+void init_rng(server_t *server, server_config_t *config);
 void handle_client(server_t *serv);
 int launch_server(server_t *serv, server_config_t *config);
 void reset_server_clients(server_t *serv);
+void display_server_info(server_config_t *config);
 int parse_args(int ac, char **av, server_config_t *config);
 int read_client_data(server_t *server, int i, char *buffer,
     size_t buffer_size);
@@ -65,15 +143,90 @@ void update_player_life(server_t *server);
 void send_gui_resource_changes(server_t *server);
 void read_client(server_t *server, server_config_t *config, int i);
 team_t *find_team(const char *name, server_config_t *config);
-void register_player(server_t *server, int client_index,
-    team_t *team, const char *team_name);
-int handle_tick(struct timeval *last_tick, server_config_t *config);
-void update_single_player_life(player_t *player);
+void register_player(server_t *server, int client_index, team_t *team);
+player_t *spawn_player(server_t *server, team_t *team, int fd);
+long handle_tick(struct timeval *last_tick, server_config_t *config);
+void update_single_player_life(server_t *server, player_t *player);
 int wait_activity(server_t *server, int timeout_ms);
 void handle_game_tick(server_t *server, server_config_t *config,
     struct timeval *last_tick, int *tick_count);
+void server_step(server_t *server, server_config_t *config,
+    struct timeval *last_tick, int *tick_count);
 void process_clients(server_t *server, server_config_t *config,
     int clients_connected);
 void add_action_to_queue(player_t *player, const char *cmd, int time);
-void send_gui(server_t *serv, const char *format, ...);
+void init_sync(server_t *server);
+void free_sync(server_t *server);
+void init_mct(server_t *server);
+void free_mct(server_t *server);
+void world_tile_changed(server_t *server, int x, int y);
+void world_player_changed(server_t *server, player_t *player);
+void world_player_removed(server_t *server, player_t *player);
+int shm_world_open(server_t *server, const char *name);
+void shm_world_close(server_t *server);
+void shm_world_tile(server_t *server, int x, int y);
+void shm_world_player(server_t *server, player_t *player, bool active);
+void shm_world_event(server_t *server, const char *line);
+void shm_world_publish(server_t *server);
+void metrics_init(server_t *server);
+void metrics_command(server_t *server, const char *name);
+void metrics_tick(server_t *server, uint64_t start_ns, long late_usec);
+void metrics_publish(server_t *server);
+void metrics_client_closed(server_t *server, int i);
+void metrics_latency(server_t *server, const char *name, uint64_t read_ns,
+    uint64_t expected_ns);
+void metrics_action_done(server_t *server, const char *name,
+    const action_t *action);
+void metrics_report(server_t *server);
+void budget_init(server_t *server);
+void budget_free(server_t *server);
+uint64_t budget_charge(server_t *server, budget_phase_t phase,
+    uint64_t start_ns);
+void budget_tick(server_t *server);
+void budget_log_floor(server_t *server);
+bool budget_defer_tile(server_t *server, int x, int y);
+void budget_flush_tiles(server_t *server);
+void budget_respawn(server_t *server, int step);
+void event_fill_player(event_t *event, const player_t *player);
+event_t *event_player(server_t *server, event_type_t type,
+    const player_t *player);
+void event_move(server_t *server, const player_t *player, int old_x,
+    int old_y);
+void event_tile(server_t *server, int x, int y);
+void event_bus_setup(server_t *server);
+void metrics_events(void *ctx, const event_t *events, size_t count,
+    const char *text);
+int admin_start(server_t *server, const char *path);
+void admin_stop(server_t *server);
+void admin_serve(server_t *server, int fd, admin_request_t *request);
+void admin_service(server_t *server);
+void admin_execute(server_t *server, admin_request_t *request);
+bool admin_hold(server_t *server);
+bool set_frequency(server_t *server, int freq);
+int record_open(server_t *server, server_config_t *config);
+void record_input(server_t *server, record_kind_t kind, int slot,
+    const char *text);
+void record_flush(server_t *server);
+void record_close(server_t *server);
+int replay_config(server_config_t *config);
+char **replay_read_args(FILE *file, int *count, uint64_t *seed);
+void replay_free_args(char **args, int count);
+int replay_run(server_t *server, server_config_t *config);
+void replay_apply(server_t *server, record_kind_t kind, int slot,
+    const char *text);
+int checkpoint_start(server_t *server);
+void checkpoint_poll(server_t *server, bool wait);
+int checkpoint_write(server_t *server, const char *path);
+int checkpoint_restore(server_t *server, server_config_t *config);
+void checkpoint_restore_players(server_t *server, const char *base);
+bool checkpoint_adopt(server_t *server, int i, team_t *team);
+long warp_tick(server_t *server, struct timeval *last_tick);
+uint64_t warp_timeout(server_t *server, uint64_t timeout_ns);
+void warp_report(server_t *server);
+int journal_open(server_t *server, server_config_t *config);
+void journal_close(server_t *server);
+size_t journal_keyframe_size(server_t *server);
+void journal_tick(server_t *server);
+void journal_sink(void *ctx, const event_t *events, size_t count,
+    const char *text);
 #endif /* !SERVER_H_ */
@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2025
+** shm_world.h
+** File description:
+** shared-memory world layout, included by the server and by zappy_gui
+*/
+
+#ifndef SHM_WORLD_H_
+    #define SHM_WORLD_H_
+    #include <stddef.h>
+    #include <stdint.h>
+    #define SHM_WORLD_MAGIC 0x5a505057u
+    #define SHM_WORLD_VERSION 1u
+    #define SHM_PLAYER_SLOTS 256
+    #define SHM_TEAM_SIZE 32
+    #define SHM_EVENT_SLOTS 1024
+    #define SHM_EVENT_SIZE 120
+    #define SHM_RESOURCES 7
+
+/*
+** Layout: header | players[SHM_PLAYER_SLOTS] | events[SHM_EVENT_SLOTS]
+** | int32_t planes[SHM_RESOURCES][width * height].
+** Header, players and planes are guarded by the seqlock in header.seq
+** (odd while the server is writing). Each event slot carries its own
+** sequence: seq == index + 1 once the line at that index is complete.
+*/
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t seq;
+    uint32_t width;
+    uint32_t height;
+    uint32_t freq;
+    uint64_t tick;
+    uint64_t event_head;
+    uint32_t pid;
+    uint32_t reserved;
+} shm_world_header_t;
+
+typedef struct {
+    int32_t id;
+    int32_t x;
+    int32_t y;
+    int32_t dir;
+    int32_t lvl;
+    int32_t active;
+    int32_t inventory[SHM_RESOURCES];
+    char team[SHM_TEAM_SIZE];
+} shm_world_player_t;
+
+typedef struct {
+    uint64_t seq;
+    uint64_t tick;
+    char line[SHM_EVENT_SIZE];
+} shm_world_event_t;
+
+static inline size_t shm_world_size(uint32_t width, uint32_t height)
+{
+    return sizeof(shm_world_header_t)
+        + sizeof(shm_world_player_t) * SHM_PLAYER_SLOTS
+        + sizeof(shm_world_event_t) * SHM_EVENT_SLOTS
+        + sizeof(int32_t) * SHM_RESOURCES * (size_t)width * height;
+}
+
+static inline shm_world_player_t *shm_world_players(void *base)
+{
+    return (shm_world_player_t *)((char *)base + sizeof(shm_world_header_t));
+}
+
+static inline shm_world_event_t *shm_world_events(void *base)
+{
+    return (shm_world_event_t *)(shm_world_players(base) + SHM_PLAYER_SLOTS);
+}
+
+static inline int32_t *shm_world_plane(void *base, int resource)
+{
+    shm_world_header_t *header = (shm_world_header_t *)base;
+
+    return (int32_t *)(shm_world_events(base) + SHM_EVENT_SLOTS)
+        + (size_t)resource * header->width * header->height;
+}
+#endif /* !SHM_WORLD_H_ */
@@ -0,0 +1,29 @@
+/*
+** EPITECH PROJECT, 2025
+** sim.h
+** File description:
+** libzappy_sim internals
+*/
+
+#ifndef SIM_H_
+    #define SIM_H_
+    #include "server.h"
+    #include "zappy_sim.h"
+
+/*
+** Without a callback, replies are appended to buffer as
+** "<agent> <reply line>" until zappy_sim_drain hands them out.
+*/
+struct zappy_sim {
+    server_t *server;
+    server_config_t config;
+    char *buffer;
+    size_t len;
+    size_t cap;
+    int tick_count;
+};
+
+int sim_config(server_config_t *config, const zappy_sim_config_t *from);
+void sim_config_free(server_config_t *config);
+void sim_buffer_reply(void *ctx, int agent, const char *line, size_t len);
+#endif /* !SIM_H_ */
@@ -0,0 +1,30 @@
+/*
+** EPITECH PROJECT, 2025
+** sync.h
+** File description:
+** per-region state hashes for GUI resync
+*/
+
+#ifndef SYNC_H_
+    #define SYNC_H_
+    #include <stdint.h>
+    #define SYNC_REGION 16
+    #define SYNC_TILE_SEED 0x54494c45ULL
+    #define SYNC_PLAYER_SEED 0x504c4159ULL
+
+/*
+** digest is the XOR of every tile and player hash, i.e. of all region
+** hashes: two runs agree on the world at a tick iff their digests do
+** (up to 64-bit collisions).
+*/
+typedef struct {
+    int cols;
+    int rows;
+    uint64_t *hashes;
+    uint64_t digest;
+} sync_grid_t;
+
+uint64_t sync_mix(uint64_t value);
+uint64_t hash_tile_state(int x, int y, const int *resources);
+uint64_t hash_player_state(const int *fields, const int *inventory);
+#endif /* !SYNC_H_ */
@@ -0,0 +1,19 @@
+/*
+** EPITECH PROJECT, 2025
+** warp.h
+** File description:
+** lockstep time-warp ticking
+*/
+
+#ifndef WARP_H_
+    #define WARP_H_
+    #include <stdint.h>
+    #define WARP_REPORT_NS 1000000000ULL
+
+typedef struct {
+    uint64_t last_ns;
+    uint64_t window_ns;
+    unsigned long window_tick;
+    double tps;
+} warp_t;
+#endif /* !WARP_H_ */
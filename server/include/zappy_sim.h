@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy_sim.h
+** File description:
+** libzappy_sim: the game without sockets, behind a C ABI
+*/
+
+#ifndef ZAPPY_SIM_H_
+    #define ZAPPY_SIM_H_
+    #include <stdbool.h>
+    #include <stddef.h>
+    #include <stdint.h>
+    #define ZAPPY_SIM_API __attribute__((visibility("default")))
+
+    #ifdef __cplusplus
+extern "C" {
+    #endif
+
+typedef struct zappy_sim zappy_sim_t;
+
+/*
+** line is one reply of the text protocol, newline included, and is only
+** valid during the call.
+*/
+typedef void (*zappy_reply_fn)(void *ctx, int agent, const char *line,
+    size_t len);
+
+typedef struct {
+    int width;
+    int height;
+    const char *const *teams;
+    int team_nb;
+    int clients_per_team;
+    int freq;
+    uint64_t seed;
+} zappy_sim_config_t;
+
+ZAPPY_SIM_API zappy_sim_t *zappy_sim_create(const zappy_sim_config_t *config);
+ZAPPY_SIM_API void zappy_sim_destroy(zappy_sim_t *sim);
+ZAPPY_SIM_API void zappy_sim_on_reply(zappy_sim_t *sim, zappy_reply_fn fn,
+    void *ctx);
+ZAPPY_SIM_API int zappy_sim_add_agent(zappy_sim_t *sim, const char *team);
+ZAPPY_SIM_API int zappy_sim_submit(zappy_sim_t *sim, int agent,
+    const char *command);
+ZAPPY_SIM_API void zappy_sim_step(zappy_sim_t *sim, unsigned long ticks);
+ZAPPY_SIM_API const char *zappy_sim_drain(zappy_sim_t *sim, size_t *len);
+ZAPPY_SIM_API unsigned long zappy_sim_tick(const zappy_sim_t *sim);
+ZAPPY_SIM_API uint64_t zappy_sim_digest(const zappy_sim_t *sim);
+ZAPPY_SIM_API bool zappy_sim_alive(const zappy_sim_t *sim, int agent);
+
+    #ifdef __cplusplus
+}
+    #endif
+#endif /* !ZAPPY_SIM_H_ */
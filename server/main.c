@@ -9,27 +9,21 @@
 #include <stdio.h>
 #include <string.h>
 
-static int check_arguments(int ac)
+static int check_arguments(int ac, char **av)
 {
-    if (ac < 9) {
+    if (ac < 9 && (ac < 3 || strcmp(av[1], "-r") != 0)) {
         fprintf(stderr, "USAGE: ./zappy_server -p port -x width -y height");
-        fprintf(stderr, " -n team1 team2 ... -c clientsNb -f freq\n");
+        fprintf(stderr, " -n team1 team2 ... -c clientsNb -f freq");
+        fprintf(stderr, " [-m shm_name] [-l level] [-L log_file]");
+        fprintf(stderr, " [-t trace.json|trace.folded] [-a admin_socket]");
+        fprintf(stderr, " [-j journal] [-s seed] [-R record] [-k checkpoint]");
+        fprintf(stderr, " [--restore checkpoint] [-w max_tps]\n");
+        fprintf(stderr, "       ./zappy_server -r record [-j journal]\n");
         return FAILURE;
     }
     return SUCCESS;
 }
 
-static void cleanup_server(server_t *server)
-{
-    if (!server) {
-        return;
-    }
-    if (server->map) {
-        free_map(server->map);
-    }
-    free(server);
-}
-
 int validate_config(const server_config_t *config)
 {
     if (config->port <= 0) {
@@ -53,23 +47,23 @@ int validate_config(const server_config_t *config)
 
 int main(int ac, char **av)
 {
-    server_t *server = malloc(sizeof(server_t));
+    server_t *server = calloc(1, sizeof(server_t));
     server_config_t config = {0};
 
-    memset(server, 0, sizeof(server_t));
-    if (!server || check_arguments(ac) != SUCCESS) {
+    if (!server || check_arguments(ac, av) != SUCCESS)
         return FAILURE;
-    }
-    if (parse_args(ac, av, &config) < 0 || validate_config(&config) < 0) {
+    if (parse_args(ac, av, &config) < 0 || (config.replay_path &&
+        replay_config(&config) < 0) || validate_config(&config) < 0)
+        return FAILURE;
+    if (log_init(config.log_level, config.log_path) < 0)
+        return FAILURE;
+    prof_init(config.prof_path);
+    if (init_world(server, &config) != SUCCESS) {
+        log_shutdown();
         return FAILURE;
     }
-    server->port = config.port;
-    create_server(server);
-    server->map = malloc(sizeof(map_t));
-    memset(server->map, 0, sizeof(map_t));
-    init_map(server->map, config.width, config.height);
-    generate_resources(server->map);
-    if (launch_server(server, &config))
+    if ((config.replay_path ? replay_run(server, &config) :
+        launch_server(server, &config)) != SUCCESS)
         return FAILURE;
     cleanup_server(server);
     return SUCCESS;
@@ -13,7 +13,7 @@ char *create_command_copy(const char *original)
     char *copy = NULL;
     size_t len = strlen(original) + 1;
 
-    copy = malloc(len);
+    copy = mem_alloc(MEM_ACTIONS, len);
     if (!copy)
         return NULL;
     strncpy(copy, original, len - 1);
@@ -23,8 +23,10 @@ char *create_command_copy(const char *original)
 
 void parse_command_args(char *command_copy, char **cmd_name, char **args)
 {
-    *cmd_name = strtok(command_copy, " ");
-    *args = strtok(NULL, "");
+    char *save = NULL;
+
+    *cmd_name = strtok_r(command_copy, " ", &save);
+    *args = strtok_r(NULL, "", &save);
 }
 
 void execute_movement_and_info_commands(server_t *server, player_t *player,
@@ -42,6 +44,8 @@ void execute_movement_and_info_commands(server_t *server, player_t *player,
         cmd_inventory(server, player);
     if (strcmp(cmd_name, "Broadcast") == 0)
         cmd_broadcast(server, player, (char *)safe_args);
+    if (strcmp(cmd_name, "Idle") == 0)
+        cmd_idle(server, player);
 }
 
 void handle_movement_commands(player_t *player, const char *cmd_name,
@@ -57,6 +61,6 @@ void handle_movement_commands(player_t *player, const char *cmd_name,
 
 void add_command_with_time(player_t *player, const char *command, int time)
 {
-    printf("Adding command to queue: %s (%d ticks)\n", command, time);
+    log_debug("Adding command to queue: %s (%d ticks)", command, time);
     add_action_to_queue(player, command, time);
 }
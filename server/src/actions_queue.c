@@ -15,13 +15,18 @@
 
 void add_action_to_queue(player_t *player, const char *cmd, int time)
 {
-    action_t *new = malloc(sizeof(action_t));
+    action_t *new = mem_alloc(MEM_ACTIONS, sizeof(action_t));
     action_t *tmp = NULL;
 
-    new->command = strdup(cmd);
+    new->command = mem_strdup(MEM_ACTIONS, cmd);
     new->remaining_ticks = time;
+    new->ticks = time;
+    new->read_ns = player->read_ns;
+    new->enqueue_ns = metrics_now_ns();
+    new->start_ns = new->enqueue_ns;
     new->next = NULL;
     if (!player->action_queue) {
+        ZAPPY_PROBE(action_start, player->id, new->command, new->ticks);
         player->action_queue = new;
         return;
     }
@@ -0,0 +1,104 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** local admin socket served from its own thread
+*/
+
+#include "server.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/un.h>
+
+static void serve_metrics(metrics_registry_t *registry, int fd, bool http)
+{
+    char *text = NULL;
+    size_t len = 0;
+    FILE *out = open_memstream(&text, &len);
+
+    if (!out)
+        return;
+    pthread_mutex_lock(&registry->lock);
+    metrics_write_prometheus(out, &registry->snapshot);
+    pthread_mutex_unlock(&registry->lock);
+    mem_write_prometheus(out);
+    fclose(out);
+    if (http)
+        dprintf(fd, "HTTP/1.0 200 OK\r\nContent-Type: text/plain; "
+            "version=0.0.4\r\nContent-Length: %zu\r\n\r\n", len);
+    write(fd, text, len);
+    free(text);
+}
+
+static void serve_client(server_t *server, int fd)
+{
+    admin_request_t request = {0};
+    struct pollfd pfd = {fd, POLLIN, 0};
+    ssize_t len = 0;
+
+    if (poll(&pfd, 1, 1000) > 0)
+        len = read(fd, request.line, sizeof(request.line) - 1);
+    if (len > 0 && strncmp(request.line, "GET ", 4) == 0)
+        serve_metrics(&server->metrics, fd, true);
+    else if (len <= 0 || strncmp(request.line, "metrics", 7) == 0)
+        serve_metrics(&server->metrics, fd, false);
+    else
+        admin_serve(server, fd, &request);
+    close(fd);
+}
+
+static void *admin_loop(void *arg)
+{
+    server_t *server = arg;
+    struct pollfd pfd = {server->metrics.fd, POLLIN, 0};
+    int client = -1;
+
+    while (atomic_load(&server->metrics.running)) {
+        if (poll(&pfd, 1, 200) <= 0)
+            continue;
+        client = accept(server->metrics.fd, NULL, NULL);
+        if (client >= 0)
+            serve_client(server, client);
+    }
+    return NULL;
+}
+
+int admin_start(server_t *server, const char *path)
+{
+    metrics_registry_t *registry = &server->metrics;
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+
+    registry->fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+    unlink(path);
+    if (registry->fd < 0 || bind(registry->fd, (struct sockaddr *)&addr,
+        sizeof(addr)) < 0 || listen(registry->fd, 8) < 0) {
+        log_error("Cannot open admin socket %s", path);
+        return FAILURE;
+    }
+    registry->path = path;
+    pthread_mutex_init(&server->admin.lock, NULL);
+    pthread_cond_init(&server->admin.done, NULL);
+    atomic_store(&registry->running, true);
+    if (pthread_create(&registry->thread, NULL, &admin_loop, server)) {
+        atomic_store(&registry->running, false);
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+void admin_stop(server_t *server)
+{
+    metrics_registry_t *registry = &server->metrics;
+
+    if (!registry->path)
+        return;
+    atomic_store(&registry->running, false);
+    pthread_join(registry->thread, NULL);
+    close(registry->fd);
+    unlink(registry->path);
+    pthread_mutex_destroy(&server->admin.lock);
+    pthread_cond_destroy(&server->admin.done);
+    registry->path = NULL;
+}
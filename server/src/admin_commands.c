@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** admin control command table, pause and resume
+*/
+
+#include "admin_commands.h"
+#include <stdlib.h>
+#include <string.h>
+
+static void admin_cmd_pause(server_t *server, FILE *out, const char *args)
+{
+    (void)args;
+    server->admin.paused = true;
+    server->admin.steps = 0;
+    fprintf(out, "ok paused at tick %lu\n", server->tick);
+}
+
+static void admin_cmd_resume(server_t *server, FILE *out, const char *args)
+{
+    (void)args;
+    server->admin.paused = false;
+    server->admin.steps = 0;
+    fprintf(out, "ok resumed at tick %lu\n", server->tick);
+}
+
+static const admin_command_t admin_commands[] = {
+    {"pause", &admin_cmd_pause},
+    {"resume", &admin_cmd_resume},
+    {"step", &admin_cmd_step},
+    {"freq", &admin_cmd_freq},
+    {"status", &admin_cmd_status},
+    {"queue", &admin_cmd_queue},
+    {"clients", &admin_cmd_clients},
+    {"respawn", &admin_cmd_respawn},
+    {"snapshot", &admin_cmd_snapshot},
+    {"checkpoint", &admin_cmd_checkpoint},
+    {NULL, NULL}
+};
+
+static void dispatch(server_t *server, FILE *out, const char *line)
+{
+    size_t len = strcspn(line, " ");
+    const char *args = line + len + strspn(line + len, " ");
+
+    for (int c = 0; admin_commands[c].name; c++) {
+        if (strlen(admin_commands[c].name) == len &&
+            strncmp(line, admin_commands[c].name, len) == 0) {
+            admin_commands[c].handler(server, out, args);
+            return;
+        }
+    }
+    fprintf(out, "ko unknown command\n");
+}
+
+void admin_execute(server_t *server, admin_request_t *request)
+{
+    FILE *out = open_memstream(&request->reply, &request->len);
+
+    request->done = true;
+    if (!out)
+        return;
+    request->line[strcspn(request->line, "\r\n")] = '\0';
+    record_input(server, RECORD_ADMIN, -1, request->line);
+    dispatch(server, out, request->line);
+    fclose(out);
+}
+
+/*
+** True while paused with no step left: the tick is skipped, and
+** handle_tick has already moved last_tick so resuming does not burst.
+*/
+bool admin_hold(server_t *server)
+{
+    if (!server->admin.paused)
+        return false;
+    if (server->admin.steps == 0)
+        return true;
+    server->admin.steps--;
+    return false;
+}
@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** admin requests handed over to the simulation thread
+*/
+
+#include "server.h"
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+static void wait_done(server_t *server, admin_request_t *request)
+{
+    admin_control_t *control = &server->admin;
+    struct timespec until;
+
+    while (!request->done && atomic_load(&server->metrics.running)) {
+        clock_gettime(CLOCK_REALTIME, &until);
+        until.tv_nsec += ADMIN_WAIT_MS * 1000000L;
+        until.tv_sec += until.tv_nsec / 1000000000L;
+        until.tv_nsec %= 1000000000L;
+        pthread_cond_timedwait(&control->done, &control->lock, &until);
+    }
+}
+
+static void drop_request(admin_control_t *control, admin_request_t *request)
+{
+    for (int i = 0; i < control->count; i++) {
+        if (control->queue[i] != request)
+            continue;
+        memmove(&control->queue[i], &control->queue[i + 1],
+            (control->count - i - 1) * sizeof(admin_request_t *));
+        control->count--;
+        atomic_store(&control->pending, control->count);
+        return;
+    }
+}
+
+/*
+** Called from the admin thread; blocks it, never the simulation.
+*/
+static int submit(server_t *server, admin_request_t *request)
+{
+    admin_control_t *control = &server->admin;
+
+    pthread_mutex_lock(&control->lock);
+    if (control->count == ADMIN_QUEUE) {
+        pthread_mutex_unlock(&control->lock);
+        return -1;
+    }
+    control->queue[control->count++] = request;
+    atomic_store(&control->pending, control->count);
+    wait_done(server, request);
+    if (!request->done)
+        drop_request(control, request);
+    pthread_mutex_unlock(&control->lock);
+    return request->done ? 0 : -1;
+}
+
+void admin_serve(server_t *server, int fd, admin_request_t *request)
+{
+    if (submit(server, request) < 0) {
+        dprintf(fd, "ko busy\n");
+        return;
+    }
+    if (request->reply)
+        write(fd, request->reply, request->len);
+    free(request->reply);
+}
+
+void admin_service(server_t *server)
+{
+    admin_control_t *control = &server->admin;
+
+    if (!atomic_load(&control->pending) ||
+        pthread_mutex_trylock(&control->lock) != 0)
+        return;
+    for (int i = 0; i < control->count; i++)
+        admin_execute(server, control->queue[i]);
+    control->count = 0;
+    atomic_store(&control->pending, 0);
+    pthread_cond_broadcast(&control->done);
+    pthread_mutex_unlock(&control->lock);
+}
@@ -0,0 +1,104 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** admin control commands: action queues, client buffers, world snapshot
+*/
+
+#include "admin_commands.h"
+#include <stdlib.h>
+#include <sys/ioctl.h>
+#include <linux/sockios.h>
+
+void admin_cmd_queue(server_t *server, FILE *out, const char *args)
+{
+    int id = atoi(args);
+    player_t *player = NULL;
+
+    for (int i = 0; i < server->player_nb && !player; i++)
+        if (server->players[i] && server->players[i]->id == id)
+            player = server->players[i];
+    if (!player) {
+        fprintf(out, "ko no player %d\n", id);
+        return;
+    }
+    fprintf(out, "player %d %s (%d,%d) level %d food %d life %d\n",
+        player->id, player->team, player->x, player->y, player->lvl,
+        player->inventory[FOOD], player->life_remain);
+    for (action_t *action = player->action_queue; action;
+        action = action->next)
+        fprintf(out, "%s %d/%d\n", action->command,
+            action->remaining_ticks, action->ticks);
+    fprintf(out, "ok\n");
+}
+
+static void client_line(server_t *server, FILE *out, int i)
+{
+    client_t *client = &server->clients[i];
+    int inq = -1;
+    int outq = -1;
+    int actions = 0;
+
+    ioctl(server->pfds[i].fd, SIOCINQ, &inq);
+    ioctl(server->pfds[i].fd, SIOCOUTQ, &outq);
+    for (action_t *action = client->player ?
+        client->player->action_queue : NULL; action; action = action->next)
+        actions++;
+    fprintf(out, "%d fd %d type %d player %d buffered %d inq %d outq %d "
+        "actions %d\n", i, server->pfds[i].fd, client->type,
+        client->player ? client->player->id : -1, client->read_len, inq,
+        outq, actions);
+}
+
+void admin_cmd_clients(server_t *server, FILE *out, const char *args)
+{
+    (void)args;
+    for (int i = 1; i < NB_CONNECTION + 1; i++)
+        if (server->pfds[i].fd != FD_NULL)
+            client_line(server, out, i);
+    fprintf(out, "ok\n");
+}
+
+static void snapshot_players(server_t *server, FILE *out)
+{
+    char line[ADMIN_LINE];
+    event_t event = {0};
+
+    for (int i = 0; i < server->player_nb; i++) {
+        if (!server->players[i])
+            continue;
+        event_fill_player(&event, server->players[i]);
+        event.type = EVENT_PNW;
+        event.text = 0;
+        event_encode_text(line, sizeof(line), &event,
+            server->players[i]->team);
+        fputs(line, out);
+        event.type = EVENT_PIN;
+        event_encode_text(line, sizeof(line), &event, NULL);
+        fputs(line, out);
+    }
+}
+
+/*
+** Full world state in GUI protocol, and a journal keyframe at the next
+** bus flush when a journal is open.
+*/
+void admin_cmd_snapshot(server_t *server, FILE *out, const char *args)
+{
+    char line[ADMIN_LINE];
+    event_t event = {.type = EVENT_BCT};
+
+    (void)args;
+    fprintf(out, "tick %lu\nmsz %d %d\nsgt %d\n", server->tick,
+        server->map->width, server->map->height, server->config->freq);
+    snapshot_players(server, out);
+    for (int y = 0; y < server->map->height; y++)
+        for (int x = 0; x < server->map->width; x++) {
+            event_fill_tile(&event, server->map, x, y);
+            event_encode_text(line, sizeof(line), &event, NULL);
+            fputs(line, out);
+        }
+    if (server->journal)
+        server->journal->next_keyframe = 0;
+    fprintf(out, "ok\n");
+}
@@ -0,0 +1,62 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** admin control commands: step, frequency, status, forced respawn
+*/
+
+#include "admin_commands.h"
+#include <stdlib.h>
+
+bool set_frequency(server_t *server, int freq)
+{
+    if (freq <= 0 || freq > 1000000)
+        return false;
+    server->config->freq = freq;
+    server->config->tick_freq = 1000000 / freq;
+    event_bus_push(&server->events, EVENT_SST)->value = freq;
+    return true;
+}
+
+void admin_cmd_step(server_t *server, FILE *out, const char *args)
+{
+    int steps = *args ? atoi(args) : 1;
+
+    if (steps <= 0) {
+        fprintf(out, "ko step count\n");
+        return;
+    }
+    server->admin.paused = true;
+    server->admin.steps += steps;
+    fprintf(out, "ok stepping %d from tick %lu\n", server->admin.steps,
+        server->tick);
+}
+
+void admin_cmd_freq(server_t *server, FILE *out, const char *args)
+{
+    if (!set_frequency(server, atoi(args))) {
+        fprintf(out, "ko frequency\n");
+        return;
+    }
+    fprintf(out, "ok freq %d\n", server->config->freq);
+}
+
+void admin_cmd_status(server_t *server, FILE *out, const char *args)
+{
+    (void)args;
+    fprintf(out, "tick %lu\nfreq %d\npaused %d\nsteps %d\nplayers %d\n"
+        "shed %d\njournal_dropped %lu\ndigest %016lx\nwarp_tps %.1f\nok\n",
+        server->tick,
+        server->config->freq, server->admin.paused, server->admin.steps,
+        server->player_nb, server->metrics.live.shed.level,
+        server->journal ? atomic_load(&server->journal->dropped) : 0,
+        (unsigned long)server->sync.digest, server->warp.tps);
+}
+
+void admin_cmd_respawn(server_t *server, FILE *out, const char *args)
+{
+    (void)args;
+    generate_resources(server->map, &server->rng[RNG_RESPAWN]);
+    send_gui_resource_changes(server);
+    fprintf(out, "ok respawned at tick %lu\n", server->tick);
+}
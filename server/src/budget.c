@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** tick budget controller
+*/
+
+#include "server.h"
+
+uint64_t budget_charge(server_t *server, budget_phase_t phase,
+    uint64_t start_ns)
+{
+    uint64_t now = metrics_now_ns();
+
+    server->budget.busy_ns[phase] += now - start_ns;
+    return now;
+}
+
+/*
+** The log floor is per thread: whoever runs a world applies that world's
+** shedding level before stepping it.
+*/
+void budget_log_floor(server_t *server)
+{
+    log_set_floor(server->metrics.live.shed.level >= SHED_LOG ?
+        LOG_WARN : LOG_TRACE);
+}
+
+static void set_level(server_t *server, int level)
+{
+    budget_stats_t *stats = &server->metrics.live.shed;
+
+    log_warn("Load shedding level %d -> %d (load %d permille)",
+        stats->level, level, stats->load_permille);
+    stats->level = level;
+    stats->transitions++;
+    record_input(server, RECORD_SHED, level, NULL);
+    budget_log_floor(server);
+    server->budget.hold = BUDGET_HOLD_TICKS;
+    server->budget.calm = 0;
+}
+
+/*
+** Escalate at most once per BUDGET_HOLD_TICKS so a level gets time to
+** take effect, and only step down after a long calm stretch.
+*/
+static void adjust_level(server_t *server)
+{
+    budget_t *budget = &server->budget;
+    int load = server->metrics.live.shed.load_permille;
+    int level = server->metrics.live.shed.level;
+
+    if (budget->hold > 0)
+        budget->hold--;
+    if (load > BUDGET_HIGH_PERMILLE)
+        budget->calm = 0;
+    if (load < BUDGET_LOW_PERMILLE)
+        budget->calm++;
+    if (load > BUDGET_HIGH_PERMILLE && !budget->hold &&
+        level < SHED_LEVELS - 1)
+        set_level(server, level + 1);
+    else if (budget->calm >= BUDGET_CALM_TICKS && level > SHED_NONE)
+        set_level(server, level - 1);
+}
+
+void budget_tick(server_t *server)
+{
+    budget_t *budget = &server->budget;
+    budget_stats_t *stats = &server->metrics.live.shed;
+    uint64_t period = (uint64_t)server->config->tick_freq * 1000;
+    uint64_t busy = 0;
+
+    for (int i = 0; i < BUDGET_PHASES; i++) {
+        stats->phase_ns[i] = (stats->phase_ns[i] * 3 + budget->busy_ns[i]) / 4;
+        busy += budget->busy_ns[i];
+        budget->busy_ns[i] = 0;
+    }
+    busy = period ? busy * 1000 / period : 0;
+    stats->load_permille = (stats->load_permille * 3 +
+        (int)(busy < 100000 ? busy : 100000)) / 4;
+    adjust_level(server);
+    stats->level_ticks[stats->level]++;
+}
@@ -0,0 +1,35 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** resource respawn, spread over the cycle while shedding
+*/
+
+#include "server.h"
+
+static void respawn_touch(void *ctx, int x, int y)
+{
+    world_tile_changed(ctx, x, y);
+}
+
+/*
+** Spread shares publish each placement to the world hashes and shm right
+** away; only the batched GUI bct output waits for the end of the cycle.
+*/
+void budget_respawn(server_t *server, int step)
+{
+    budget_t *budget = &server->budget;
+    rng_t *rng = &server->rng[RNG_RESPAWN];
+
+    if (step == 0)
+        budget->spreading = server->metrics.live.shed.level >= SHED_RESPAWN;
+    if (budget->spreading) {
+        server->map->touch = &respawn_touch;
+        server->map->touch_ctx = server;
+        generate_resources_share(server->map, rng, step, RESPAWN_TICKS);
+        server->map->touch = NULL;
+        server->metrics.live.shed.spread_ticks++;
+    } else if (step == RESPAWN_TICKS - 1) {
+        generate_resources(server->map, rng);
+    }
+}
@@ -0,0 +1,66 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** work deferred while the tick budget is exceeded
+*/
+
+#include "gui.h"
+
+void budget_init(server_t *server)
+{
+    map_t *map = server->map;
+
+    server->budget.pending = mem_alloc(MEM_GUI,
+        sizeof(int) * map->width * map->height);
+    server->budget.pending_nb = 0;
+}
+
+void budget_free(server_t *server)
+{
+    mem_free(MEM_GUI, server->budget.pending);
+    server->budget.pending = NULL;
+}
+
+/*
+** A tile is queued once: tile->queued stays set until the flush, so
+** later changes to it in the same window only count as conflated.
+** tile->changed is shared with the respawn scan and says nothing about
+** the queue: a tile it already marked must still be queued here.
+*/
+bool budget_defer_tile(server_t *server, int x, int y)
+{
+    budget_t *budget = &server->budget;
+    tile_t *tile = &server->map->tiles[y][x];
+
+    if (server->metrics.live.shed.level < SHED_GUI || !budget->pending)
+        return false;
+    tile->changed = true;
+    if (!tile->queued) {
+        tile->queued = true;
+        budget->pending[budget->pending_nb] = y * server->map->width + x;
+        budget->pending_nb++;
+    }
+    server->metrics.live.shed.deferred_tiles++;
+    return true;
+}
+
+void budget_flush_tiles(server_t *server)
+{
+    PROF_FUNC();
+    budget_t *budget = &server->budget;
+    int width = server->map->width;
+    tile_t *tile = NULL;
+
+    for (int i = 0; i < budget->pending_nb; i++) {
+        tile = &server->map->tiles[budget->pending[i] / width]
+            [budget->pending[i] % width];
+        tile->queued = false;
+        if (!tile->changed)
+            continue;
+        tile->changed = false;
+        event_tile(server, budget->pending[i] % width,
+            budget->pending[i] / width);
+    }
+    budget->pending_nb = 0;
+}
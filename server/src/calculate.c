@@ -11,12 +11,12 @@
 char *create_tile_content(tile_context_t *ctx)
 {
     size_t needed_size = calculate_tile_content_size(ctx);
-    char *tile_content = malloc(needed_size);
+    char *tile_content = mem_alloc(MEM_RESPONSES, needed_size);
 
     if (!tile_content)
         return NULL;
     if (!build_tile_content(ctx, tile_content, needed_size)) {
-        free(tile_content);
+        mem_free(MEM_RESPONSES, tile_content);
         return NULL;
     }
     return tile_content;
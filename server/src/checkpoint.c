@@ -0,0 +1,84 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** checkpoint scheduling: fork a child that writes the world
+*/
+
+#include "admin_commands.h"
+#include <sys/wait.h>
+#include <unistd.h>
+
+void checkpoint_layout(checkpoint_header_t *header)
+{
+    header->header_size = sizeof(checkpoint_header_t);
+    header->tiles = CHECKPOINT_ALIGN(header->header_size);
+    header->teams = CHECKPOINT_ALIGN(header->tiles + (uint64_t)header->width
+        * header->height * sizeof(checkpoint_tile_t));
+    header->players = CHECKPOINT_ALIGN(header->teams + header->team_nb *
+        sizeof(checkpoint_team_t));
+    header->actions = CHECKPOINT_ALIGN(header->players +
+        header->player_count * sizeof(checkpoint_player_t));
+    header->size = header->actions + header->action_nb *
+        sizeof(checkpoint_action_t);
+}
+
+/*
+** The child sees the world frozen at this tick through copy-on-write
+** pages; the simulation only pays for fork() itself.
+*/
+int checkpoint_start(server_t *server)
+{
+    checkpoint_t *checkpoint = &server->checkpoint;
+
+    if (!checkpoint->path || checkpoint->pid > 0)
+        return -1;
+    checkpoint->start_ns = metrics_now_ns();
+    checkpoint->tick = server->tick;
+    checkpoint->pid = fork();
+    if (checkpoint->pid == 0)
+        _exit(checkpoint_write(server, checkpoint->path) < 0);
+    if (checkpoint->pid < 0) {
+        log_error("Checkpoint fork failed: errno %d", errno);
+        checkpoint->pid = 0;
+        return -1;
+    }
+    return 0;
+}
+
+/*
+** The periodic checkpoint is due once next_tick is reached: if the last
+** child is still writing, it starts on the first pass after it exits.
+*/
+void checkpoint_poll(server_t *server, bool wait)
+{
+    checkpoint_t *checkpoint = &server->checkpoint;
+    int status = 0;
+    pid_t done = 0;
+
+    if (checkpoint->pid > 0)
+        done = waitpid(checkpoint->pid, &status, wait ? 0 : WNOHANG);
+    if (done > 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0)
+        log_info("Checkpoint of tick %lu saved to %s after %.1f ms",
+            checkpoint->tick, checkpoint->path,
+            (metrics_now_ns() - checkpoint->start_ns) / 1e6);
+    else if (done != 0)
+        log_error("Checkpoint of tick %lu failed", checkpoint->tick);
+    if (done != 0)
+        checkpoint->pid = 0;
+    if (!wait && server->tick >= checkpoint->next_tick &&
+        checkpoint_start(server) == 0)
+        checkpoint->next_tick = server->tick + CHECKPOINT_TICKS;
+}
+
+void admin_cmd_checkpoint(server_t *server, FILE *out, const char *args)
+{
+    (void)args;
+    if (checkpoint_start(server) < 0) {
+        fprintf(out, "ko %s\n", server->checkpoint.path ?
+            "checkpoint in progress" : "no checkpoint file (-k)");
+        return;
+    }
+    fprintf(out, "ok checkpoint of tick %lu to %s\n", server->tick,
+        server->checkpoint.path);
+}
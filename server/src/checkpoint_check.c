@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** --restore: reject checkpoints whose records do not fit the world
+*/
+
+#include "server.h"
+#include <string.h>
+
+static bool player_valid(const checkpoint_header_t *header,
+    const checkpoint_player_t *saved)
+{
+    return saved->slot >= 0 && saved->slot < header->player_nb &&
+        saved->x >= 0 && saved->x < header->width &&
+        saved->y >= 0 && saved->y < header->height &&
+        saved->lvl >= 1 && saved->lvl <= CHECKPOINT_LEVEL_MAX &&
+        saved->dir >= 0 && saved->dir < 4 && saved->action_nb >= 0 &&
+        memchr(saved->team, '\0', CHECKPOINT_NAME) != NULL;
+}
+
+static bool actions_valid(const checkpoint_action_t *actions, int count)
+{
+    for (int i = 0; i < count; i++)
+        if (actions[i].ticks < 0 || actions[i].remaining_ticks < 0 ||
+            memchr(actions[i].command, '\0', BUF_SIZE) == NULL)
+            return false;
+    return true;
+}
+
+/*
+** Runs once the header layout matched the file size: every player must
+** sit on the map in a free slot range, and their action counts must add
+** up to the action section.
+*/
+bool checkpoint_records_valid(const char *base)
+{
+    const checkpoint_header_t *header = (const checkpoint_header_t *)base;
+    const checkpoint_team_t *team = (const void *)(base + header->teams);
+    const checkpoint_player_t *saved = (const void *)(base +
+        header->players);
+    int64_t actions = 0;
+
+    for (int i = 0; i < header->team_nb; i++)
+        if (memchr(team[i].name, '\0', CHECKPOINT_NAME) == NULL)
+            return false;
+    for (int i = 0; i < header->player_count; i++) {
+        if (!player_valid(header, &saved[i]))
+            return false;
+        actions += saved[i].action_nb;
+    }
+    return actions == header->action_nb && actions_valid((const void *)
+        (base + header->actions), header->action_nb);
+}
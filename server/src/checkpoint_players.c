@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** restored players and their reattachment to new clients
+*/
+
+#include "server.h"
+#include <string.h>
+
+static void restore_actions(player_t *player,
+    const checkpoint_action_t *actions, int count)
+{
+    action_t *last = NULL;
+
+    for (int i = 0; i < count; i++) {
+        add_action_to_queue(player, actions[i].command, actions[i].ticks);
+        last = last ? last->next : player->action_queue;
+        last->remaining_ticks = actions[i].remaining_ticks;
+    }
+}
+
+static player_t *restore_player(const checkpoint_player_t *saved)
+{
+    player_t *player = mem_calloc(MEM_PLAYERS, 1, sizeof(player_t));
+
+    if (!player)
+        return NULL;
+    player->id = saved->id;
+    player->fd = FD_NULL;
+    player->x = saved->x;
+    player->y = saved->y;
+    player->lvl = saved->lvl;
+    player->dir = saved->dir;
+    player->life_remain = saved->life_remain;
+    player->food_tick = saved->food_tick;
+    memcpy(player->inventory, saved->inventory, sizeof(player->inventory));
+    player->team = mem_strdup(MEM_PLAYERS, saved->team);
+    player->region = -1;
+    return player;
+}
+
+/*
+** Restored players have no client until someone joins their team.
+*/
+void checkpoint_restore_players(server_t *server, const char *base)
+{
+    const checkpoint_header_t *header = (const checkpoint_header_t *)base;
+    const checkpoint_player_t *saved = (const void *)(base +
+        header->players);
+    const checkpoint_action_t *actions = (const void *)(base +
+        header->actions);
+    player_t *player = NULL;
+
+    server->player_nb = header->player_nb;
+    for (int i = 0; i < header->player_count; i++) {
+        player = saved[i].slot >= 0 && saved[i].slot < header->player_nb ?
+            restore_player(&saved[i]) : NULL;
+        if (player) {
+            server->players[saved[i].slot] = player;
+            restore_actions(player, actions, saved[i].action_nb);
+        }
+        actions += saved[i].action_nb;
+    }
+}
+
+bool checkpoint_adopt(server_t *server, int i, team_t *team)
+{
+    player_t *player = NULL;
+
+    for (int p = 0; p < server->player_nb && !player; p++)
+        if (server->players[p] && server->players[p]->fd == FD_NULL &&
+            strcmp(server->players[p]->team, team->name) == 0)
+            player = server->players[p];
+    if (!player)
+        return false;
+    player->fd = server->pfds[i].fd;
+    server->clients[i].type = CLIENT_IA;
+    server->clients[i].player = player;
+    dprintf(player->fd, "%d\n", team->max_players - team->actual_players);
+    dprintf(player->fd, "%d %d\n", server->map->width, server->map->height);
+    log_info("Player %d restored for client %d (team %s)", player->id, i,
+        team->name);
+    return true;
+}
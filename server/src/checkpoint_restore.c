@@ -0,0 +1,108 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** --restore: map a checkpoint and rebuild the world from it
+*/
+
+#include "server.h"
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char *map_checkpoint(const char *path, size_t *length)
+{
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    void *map = MAP_FAILED;
+
+    if (fd < 0)
+        return NULL;
+    if (fstat(fd, &st) == 0 &&
+        (size_t)st.st_size >= sizeof(checkpoint_header_t))
+        map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return NULL;
+    *length = st.st_size;
+    return map;
+}
+
+static bool checkpoint_valid(const checkpoint_header_t *header,
+    size_t length)
+{
+    checkpoint_header_t expected = *header;
+
+    checkpoint_layout(&expected);
+    return header->magic == CHECKPOINT_MAGIC &&
+        header->version == CHECKPOINT_VERSION && header->width > 0 &&
+        header->height > 0 && header->width <= CHECKPOINT_SIDE_MAX &&
+        header->height <= CHECKPOINT_SIDE_MAX && header->team_nb >= 0 &&
+        header->team_nb <= CHECKPOINT_TEAMS_MAX && header->player_nb >= 0 &&
+        header->player_nb <= MAX_PLAYERS && header->player_count >= 0 &&
+        header->player_count <= header->player_nb && header->action_nb >= 0 &&
+        memcmp(&expected, header, sizeof(expected)) == 0 &&
+        header->size <= length;
+}
+
+static void restore_header(server_t *server, server_config_t *config,
+    const checkpoint_header_t *header)
+{
+    config->width = header->width;
+    config->height = header->height;
+    config->seed = header->seed;
+    config->seeded = true;
+    memcpy(server->rng, header->rng, sizeof(server->rng));
+    server->tick = header->tick;
+}
+
+static void restore_world(server_t *server, server_config_t *config,
+    const char *base)
+{
+    const checkpoint_header_t *header = (const checkpoint_header_t *)base;
+    const checkpoint_tile_t *tile = (const void *)(base + header->tiles);
+    const checkpoint_team_t *saved = (const void *)(base + header->teams);
+    team_t *team = NULL;
+
+    init_map(server->map, header->width, header->height);
+    for (int y = 0; y < header->height; y++)
+        for (int x = 0; x < header->width; x++)
+            memcpy(server->map->tiles[y][x].resources,
+                tile[y * header->width + x].resources,
+                sizeof(tile->resources));
+    for (int i = 0; i < header->team_nb; i++) {
+        team = find_team(saved[i].name, config);
+        if (!team) {
+            log_warn("Checkpoint team %s is not in -n", saved[i].name);
+            continue;
+        }
+        team->actual_players = saved[i].actual_players;
+        team->eggs_available = saved[i].eggs_available;
+    }
+}
+
+int checkpoint_restore(server_t *server, server_config_t *config)
+{
+    uint64_t start_ns = metrics_now_ns();
+    size_t length = 0;
+    const char *base = map_checkpoint(config->restore_path, &length);
+    const checkpoint_header_t *header = (const checkpoint_header_t *)base;
+
+    if (!base || !checkpoint_valid(header, length) ||
+        !checkpoint_records_valid(base)) {
+        log_error("Invalid checkpoint %s", config->restore_path);
+        if (base)
+            munmap((void *)base, length);
+        return -1;
+    }
+    restore_header(server, config, header);
+    restore_world(server, config, base);
+    checkpoint_restore_players(server, base);
+    log_info("Restored tick %lu, %d players, seed %lu from %s in %.2f ms",
+        server->tick, header->player_count, (unsigned long)config->seed,
+        config->restore_path, (metrics_now_ns() - start_ns) / 1e6);
+    munmap((void *)base, length);
+    return 0;
+}
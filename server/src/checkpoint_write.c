@@ -0,0 +1,119 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** checkpoint child: serialise the world into the mapped file
+*/
+
+#include "server.h"
+#include <fcntl.h>
+#include <limits.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+static void fill_header(server_t *server, checkpoint_header_t *header)
+{
+    *header = (checkpoint_header_t){.magic = CHECKPOINT_MAGIC,
+        .version = CHECKPOINT_VERSION, .width = server->map->width,
+        .height = server->map->height,
+        .team_nb = server->config->team_nb,
+        .player_nb = server->player_nb, .tick = server->tick,
+        .seed = server->config->seed};
+    memcpy(header->rng, server->rng, sizeof(header->rng));
+    for (int i = 0; i < server->player_nb; i++) {
+        if (!server->players[i])
+            continue;
+        header->player_count++;
+        for (action_t *action = server->players[i]->action_queue; action;
+            action = action->next)
+            header->action_nb++;
+    }
+    checkpoint_layout(header);
+}
+
+static void write_world(server_t *server, char *base,
+    const checkpoint_header_t *header)
+{
+    checkpoint_tile_t *tile = (checkpoint_tile_t *)(base + header->tiles);
+    checkpoint_team_t *team = (checkpoint_team_t *)(base + header->teams);
+    team_t *teams = server->config->teams;
+
+    for (int y = 0; y < header->height; y++)
+        for (int x = 0; x < header->width; x++) {
+            memcpy(tile->resources, server->map->tiles[y][x].resources,
+                sizeof(tile->resources));
+            tile++;
+        }
+    for (int i = 0; i < header->team_nb; i++) {
+        strncpy(team[i].name, teams[i].name, CHECKPOINT_NAME - 1);
+        team[i].max_players = teams[i].max_players;
+        team[i].actual_players = teams[i].actual_players;
+        team[i].eggs_available = teams[i].eggs_available;
+    }
+}
+
+static int write_actions(const player_t *player, checkpoint_action_t *out)
+{
+    int count = 0;
+
+    for (action_t *action = player->action_queue; action;
+        action = action->next) {
+        out[count].remaining_ticks = action->remaining_ticks;
+        out[count].ticks = action->ticks;
+        strncpy(out[count].command, action->command, BUF_SIZE - 1);
+        count++;
+    }
+    return count;
+}
+
+static void write_players(server_t *server, char *base,
+    const checkpoint_header_t *header)
+{
+    checkpoint_player_t *out = (checkpoint_player_t *)(base +
+        header->players);
+    checkpoint_action_t *actions = (checkpoint_action_t *)(base +
+        header->actions);
+    player_t *p = NULL;
+
+    for (int i = 0; i < server->player_nb; i++) {
+        p = server->players[i];
+        if (!p)
+            continue;
+        *out = (checkpoint_player_t){i, p->id, p->x, p->y, p->lvl, p->dir,
+            p->life_remain, p->food_tick, 0, {0}, {0}};
+        memcpy(out->inventory, p->inventory, sizeof(out->inventory));
+        strncpy(out->team, p->team, CHECKPOINT_NAME - 1);
+        out->action_nb = write_actions(p, actions);
+        actions += out->action_nb;
+        out++;
+    }
+}
+
+/*
+** Runs in the forked child: no allocation, no logging. The file is
+** written beside the target and renamed so a crash keeps the last one.
+*/
+int checkpoint_write(server_t *server, const char *path)
+{
+    char tmp[PATH_MAX];
+    checkpoint_header_t header;
+    char *base = MAP_FAILED;
+    int fd = -1;
+
+    fill_header(server, &header);
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    fd = open(tmp, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd >= 0 && ftruncate(fd, header.size) == 0)
+        base = mmap(NULL, header.size, PROT_READ | PROT_WRITE, MAP_SHARED,
+            fd, 0);
+    if (base == MAP_FAILED)
+        return -1;
+    memcpy(base, &header, sizeof(header));
+    write_world(server, base, &header);
+    write_players(server, base, &header);
+    munmap(base, header.size);
+    if (fsync(fd) < 0 || close(fd) < 0)
+        return -1;
+    return rename(tmp, path);
+}
@@ -6,7 +6,7 @@
 */
 
 #include "commands.h"
-#include "server.h"
+#include "gui.h"
 
 resource_type_t get_resource_type(const char *name)
 {
@@ -49,17 +49,19 @@ const char *get_resource_name(resource_type_t type)
     }
 }
 
-static void send_forward_response(server_t *server, player_t *player)
+static void send_forward_response(server_t *server, player_t *player,
+    position_t old)
 {
-    dprintf(player->fd, "ok\n");
-    dprintf(server->gui_fd, "ppo %d %d %d %d\n",
-            player->id, player->x, player->y, player->dir + 1);
+    player_reply(server, player, "ok\n");
+    event_move(server, player, old.x, old.y);
 }
 
 void cmd_forward(server_t *s, player_t *p)
 {
+    PROF_FUNC();
     int new_x = p->x;
     int new_y = p->y;
+    position_t old = {p->x, p->y};
 
     switch (p->dir) {
         case UP:
@@ -77,19 +79,26 @@ void cmd_forward(server_t *s, player_t *p)
     }
     p->x = new_x;
     p->y = new_y;
-    send_forward_response(s, p);
+    world_player_changed(s, p);
+    send_forward_response(s, p, old);
 }
 
 void cmd_right(server_t *s, player_t *p)
 {
+    PROF_FUNC();
+
     p->dir = (p->dir + 1) % 4;
-    dprintf(p->fd, "ok\n");
-    dprintf(s->gui_fd, "ppo %d %d %d %d\n", p->id, p->x, p->y, p->dir + 1);
+    world_player_changed(s, p);
+    player_reply(s, p, "ok\n");
+    event_move(s, p, p->x, p->y);
 }
 
 void cmd_left(server_t *s, player_t *p)
 {
+    PROF_FUNC();
+
     p->dir = (p->dir - 1 + 4) % 4;
-    dprintf(p->fd, "ok\n");
-    dprintf(s->gui_fd, "ppo %d %d %d %d\n", p->id, p->x, p->y, p->dir + 1);
+    world_player_changed(s, p);
+    player_reply(s, p, "ok\n");
+    event_move(s, p, p->x, p->y);
 }
@@ -7,6 +7,7 @@
 
 #include "server.h"
 #include "commands.h"
+#include "gui.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -17,8 +18,10 @@
 
 static void update_all_players_life(server_t *server)
 {
+    PROF_FUNC();
+
     for (int i = 0; i < server->player_nb; i++) {
-        update_single_player_life(server->players[i]);
+        update_single_player_life(server, server->players[i]);
     }
 }
 
@@ -29,19 +32,25 @@ void update_game_state(server_t *server)
     update_all_players_life(server);
 }
 
-static void cleanup_disconnected_client(server_t *server, int i)
+void cleanup_disconnected_client(server_t *server, int i)
 {
-    printf("Client %d disconnected (fd=%d)\n", i, server->pfds[i].fd);
+    log_info("Client %d disconnected (fd=%d)", i, server->pfds[i].fd);
+    record_input(server, RECORD_HANGUP, i, NULL);
+    metrics_client_closed(server, i);
     close(server->pfds[i].fd);
     server->pfds[i].fd = FD_NULL;
     server->clients[i].fd = FD_NULL;
     server->clients[i].type = -1;
     server->clients[i].player = NULL;
+    server->clients[i].read_len = 0;
+    gui_unsubscribe_view(server, i);
     server->nb_clients--;
 }
 
 void remove_disconnected_clients(server_t *server)
 {
+    PROF_FUNC();
+
     for (int i = 1; i < NB_CONNECTION + 1; i++) {
         if (server->pfds[i].fd == FD_NULL)
             continue;
@@ -52,6 +61,8 @@ void remove_disconnected_clients(server_t *server)
 
 void process_new_connections(server_t *server)
 {
+    PROF_FUNC();
+
     if (server->pfds[0].revents & POLLIN)
         handle_client(server);
 }
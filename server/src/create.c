@@ -12,7 +12,7 @@ char *create_resource_info(int resource_index, int quantity)
 {
     const char *resource_name = get_resource_name(resource_index);
     size_t needed_size = strlen(resource_name) + 20;
-    char *resource_info = malloc(needed_size);
+    char *resource_info = mem_alloc(MEM_RESPONSES, needed_size);
 
     if (!resource_info)
         return NULL;
@@ -33,7 +33,7 @@ bool add_single_resource(tile_t *tile, char *tile_content, bool *first_item,
     if (!resource_info)
         return false;
     strcat(tile_content, resource_info);
-    free(resource_info);
+    mem_free(MEM_RESPONSES, resource_info);
     *first_item = false;
     return true;
 }
@@ -50,7 +50,7 @@ void add_resources_to_tile_content(tile_t *tile, char *tile_content,
 char *create_player_info(int player_count)
 {
     size_t needed_size = 20;
-    char *player_info = malloc(needed_size);
+    char *player_info = mem_alloc(MEM_RESPONSES, needed_size);
 
     if (!player_info)
         return NULL;
@@ -71,5 +71,5 @@ void add_players_to_tile_content(int player_count, char *tile_content,
     if (!player_info)
         return;
     strcat(tile_content, player_info);
-    free(player_info);
+    mem_free(MEM_RESPONSES, player_info);
 }
@@ -12,7 +12,7 @@ char *format_inventory_item(int resource_index, int quantity)
 {
     const char *resource_name = get_resource_name(resource_index);
     int needed_size = strlen(resource_name) + 20;
-    char *item = malloc(needed_size);
+    char *item = mem_alloc(MEM_RESPONSES, needed_size);
 
     if (!item)
         return NULL;
@@ -61,7 +61,7 @@ bool process_single_item(player_t *player, int i, char *response, bool *first)
     if (!item)
         return false;
     add_item_to_response(response, item, *first);
-    free(item);
+    mem_free(MEM_RESPONSES, item);
     *first = false;
     return true;
 }
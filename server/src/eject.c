@@ -6,7 +6,7 @@
 */
 
 #include "commands.h"
-#include "server.h"
+#include "gui.h"
 
 position_t calculate_ejection_position(player_t *ejector, server_t *server)
 {
@@ -41,15 +41,16 @@ bool eject_player_from_tile(server_t *server, player_t *ejector,
     new_pos = calculate_ejection_position(ejector, server);
     target->x = new_pos.x;
     target->y = new_pos.y;
-    dprintf(target->fd, "eject: %d\n", (ejector->dir + 2) % 4);
-    dprintf(server->gui_fd, "pex #%d\n", ejector->id);
-    dprintf(server->gui_fd, "ppo #%d %d %d %d\n",
-            target->id, target->x, target->y, target->dir);
+    world_player_changed(server, target);
+    player_reply(server, target, "eject: %d\n", (ejector->dir + 2) % 4);
+    event_player(server, EVENT_PEX, ejector);
+    event_move(server, target, ejector->x, ejector->y);
     return true;
 }
 
 void cmd_eject(server_t *server, player_t *player)
 {
+    PROF_FUNC();
     bool ejected_someone = false;
 
     for (int i = 0; i < server->player_nb; i++) {
@@ -57,85 +58,60 @@ void cmd_eject(server_t *server, player_t *player)
             ejected_someone = true;
         }
     }
-    dprintf(player->fd, ejected_someone ? "ok\n" : "ko\n");
+    player_reply(server, player, ejected_someone ? "ok\n" : "ko\n");
 }
 
 static void send_gui_pgt(server_t *server, player_t *player,
     resource_type_t res)
 {
-    tile_t *tile = &server->map->tiles[player->y][player->x];
-
-    if (server->gui_fd == -1)
-        return;
-    dprintf(server->gui_fd, "pgt %d %d\n", player->id, res);
-    dprintf(server->gui_fd, "pin %d %d %d %d %d %d %d %d %d %d\n",
-        player->id, player->x, player->y,
-        player->inventory[FOOD], player->inventory[LINEMATE],
-        player->inventory[DERAUMERE], player->inventory[SIBUR],
-        player->inventory[MENDIANE], player->inventory[PHIRAS],
-        player->inventory[THYSTAME]);
-    dprintf(server->gui_fd, "bct %d %d %d %d %d %d %d %d %d\n",
-        player->x, player->y,
-        tile->resources[FOOD], tile->resources[LINEMATE],
-        tile->resources[DERAUMERE], tile->resources[SIBUR],
-        tile->resources[MENDIANE], tile->resources[PHIRAS],
-        tile->resources[THYSTAME]);
+    event_player(server, EVENT_PGT, player)->value = res;
+    event_player(server, EVENT_PIN, player);
+    send_gui_tile_content(server, player->x, player->y);
 }
 
 void cmd_take(server_t *server, player_t *player, char *args)
 {
+    PROF_FUNC();
     resource_type_t resource = get_resource_type(args);
     tile_t *tile = &server->map->tiles[player->y][player->x];
 
-    if (resource == RESOURCE_INVALID) {
-        dprintf(player->fd, "ko\n");
+    if (resource == RESOURCE_INVALID || tile->resources[resource] == 0) {
+        player_reply(server, player, "ko\n");
         return;
     }
-    if (tile->resources[resource] > 0) {
-        tile->resources[resource]--;
-        player->inventory[resource]++;
-        dprintf(player->fd, "ok\n");
-        send_gui_pgt(server, player, resource);
-    }
-    dprintf(player->fd, "ko\n");
+    tile->resources[resource]--;
+    player->inventory[resource]++;
+    world_tile_changed(server, player->x, player->y);
+    world_player_changed(server, player);
+    player_reply(server, player, "ok\n");
+    send_gui_pgt(server, player, resource);
 }
 
 static void send_gui_pdr(server_t *server, player_t *player,
     resource_type_t res)
 {
-    tile_t *tile = &server->map->tiles[player->y][player->x];
-
-    if (server->gui_fd == -1)
-        return;
-    dprintf(server->gui_fd, "pdr %d %d\n", player->id, res);
-    dprintf(server->gui_fd, "pin %d %d %d %d %d %d %d %d %d %d\n",
-        player->id, player->x, player->y,
-        player->inventory[FOOD], player->inventory[LINEMATE],
-        player->inventory[DERAUMERE], player->inventory[SIBUR],
-        player->inventory[MENDIANE], player->inventory[PHIRAS],
-        player->inventory[THYSTAME]);
-    dprintf(server->gui_fd, "bct %d %d %d %d %d %d %d %d %d\n",
-        player->x, player->y,
-        tile->resources[FOOD], tile->resources[LINEMATE],
-        tile->resources[DERAUMERE], tile->resources[SIBUR],
-        tile->resources[MENDIANE], tile->resources[PHIRAS],
-        tile->resources[THYSTAME]);
+    event_player(server, EVENT_PDR, player)->value = res;
+    event_player(server, EVENT_PIN, player);
+    send_gui_tile_content(server, player->x, player->y);
 }
 
 void cmd_set(server_t *server, player_t *player, char *args)
 {
+    PROF_FUNC();
     resource_type_t resource = get_resource_type(args);
 
     if (resource == RESOURCE_INVALID) {
-        dprintf(player->fd, "ko\n");
+        player_reply(server, player, "ko\n");
         return;
     }
     if (player->inventory[resource] > 0) {
         player->inventory[resource]--;
         server->map->tiles[player->y][player->x].resources[resource]++;
-        dprintf(player->fd, "ok\n");
+        world_tile_changed(server, player->x, player->y);
+        world_player_changed(server, player);
+        player_reply(server, player, "ok\n");
         send_gui_pdr(server, player, resource);
     } else {
-        dprintf(player->fd, "ko\n");
+        player_reply(server, player, "ko\n");
     }
 }
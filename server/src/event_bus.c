@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** per-iteration event batch and its subscribers
+*/
+
+#include "events.h"
+#include "mem.h"
+#include <string.h>
+
+/*
+** Publishing never fails for the caller: on allocation failure the
+** record goes to a scratch slot that is never flushed (one per thread,
+** since worlds may tick on different threads).
+*/
+event_t *event_bus_push(event_bus_t *bus, int type)
+{
+    static __thread event_t dropped;
+    size_t capacity = bus->capacity ? bus->capacity * 2 : EVENT_INITIAL;
+    event_t *grown = NULL;
+
+    if (bus->count == bus->capacity) {
+        grown = mem_realloc(MEM_EVENTS, bus->events,
+            capacity * sizeof(event_t));
+        if (!grown)
+            return &dropped;
+        bus->events = grown;
+        bus->capacity = capacity;
+    }
+    memset(&bus->events[bus->count], 0, sizeof(event_t));
+    bus->events[bus->count].type = type;
+    bus->events[bus->count].text = EVENT_NO_TEXT;
+    return &bus->events[bus->count++];
+}
+
+uint32_t event_bus_text(event_bus_t *bus, const char *str)
+{
+    size_t len = strlen(str) + 1;
+    size_t capacity = bus->text_cap ? bus->text_cap : EVENT_TEXT_INITIAL;
+    char *grown = NULL;
+    uint32_t offset = bus->text_len;
+
+    while (capacity < bus->text_len + len)
+        capacity *= 2;
+    if (capacity != bus->text_cap) {
+        grown = mem_realloc(MEM_EVENTS, bus->text, capacity);
+        if (!grown)
+            return EVENT_NO_TEXT;
+        bus->text = grown;
+        bus->text_cap = capacity;
+    }
+    memcpy(bus->text + offset, str, len);
+    bus->text_len += len;
+    return offset;
+}
+
+int event_bus_subscribe(event_bus_t *bus, event_sink_t sink, void *ctx)
+{
+    if (bus->sink_nb >= EVENT_SINKS)
+        return -1;
+    bus->sinks[bus->sink_nb] = sink;
+    bus->ctx[bus->sink_nb] = ctx;
+    bus->sink_nb++;
+    return 0;
+}
+
+void event_bus_flush(event_bus_t *bus)
+{
+    if (!bus->count)
+        return;
+    for (int i = 0; i < bus->sink_nb; i++)
+        bus->sinks[i](bus->ctx[i], bus->events, bus->count, bus->text);
+    bus->count = 0;
+    bus->text_len = 0;
+}
+
+void event_bus_free(event_bus_t *bus)
+{
+    mem_free(MEM_EVENTS, bus->events);
+    mem_free(MEM_EVENTS, bus->text);
+    memset(bus, 0, sizeof(event_bus_t));
+}
@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** GUI protocol text encoding of events
+*/
+
+#include "events.h"
+#include <stdio.h>
+
+/*
+** Fields: i id, x / y position, d direction, l level, v value,
+** r the seven resource counts, t the event text.
+*/
+static const struct {
+    const char *name;
+    const char *fields;
+    int route;
+} layouts[EVENT_TYPES] = {
+    [EVENT_PNW] = {"pnw", "ixydlt", EVENT_TO_ALL | EVENT_TO_SHM},
+    [EVENT_PPO] = {"ppo", "ixyd", EVENT_TO_MOVE},
+    [EVENT_PLV] = {"plv", "il", EVENT_TO_ALL | EVENT_TO_SHM},
+    [EVENT_PIN] = {"pin", "ixyr", EVENT_TO_TILE},
+    [EVENT_BCT] = {"bct", "xyr", EVENT_TO_TILE},
+    [EVENT_PEX] = {"pex", "i", EVENT_TO_ALL | EVENT_TO_SHM},
+    [EVENT_PBC] = {"pbc", "it", EVENT_TO_ALL | EVENT_TO_SHM},
+    [EVENT_PIC] = {"pic", "xyli", EVENT_TO_ALL | EVENT_TO_SHM},
+    [EVENT_PIE] = {"pie", "xyv", EVENT_TO_ALL | EVENT_TO_SHM},
+    [EVENT_PFK] = {"pfk", "i", EVENT_TO_ALL | EVENT_TO_SHM},
+    [EVENT_PDR] = {"pdr", "iv", EVENT_TO_TILE | EVENT_TO_SHM},
+    [EVENT_PGT] = {"pgt", "iv", EVENT_TO_TILE | EVENT_TO_SHM},
+    [EVENT_PDI] = {"pdi", "i", EVENT_TO_ALL | EVENT_TO_SHM},
+    [EVENT_SST] = {"sst", "v", EVENT_TO_ALL | EVENT_TO_SHM},
+};
+
+static int scalar(char field, const event_t *event)
+{
+    switch (field) {
+        case 'i':
+            return event->id;
+        case 'x':
+            return event->x;
+        case 'y':
+            return event->y;
+        case 'd':
+            return event->dir + 1;
+        case 'l':
+            return event->level;
+        default:
+            return event->value;
+    }
+}
+
+static int encode_field(char *buf, size_t size, char field,
+    const event_t *event, const char *text)
+{
+    const int *r = event->items;
+
+    if (field == 't')
+        return snprintf(buf, size, " %s",
+            event->text == EVENT_NO_TEXT ? "" : text + event->text);
+    if (field == 'r')
+        return snprintf(buf, size, " %d %d %d %d %d %d %d", r[FOOD],
+            r[LINEMATE], r[DERAUMERE], r[SIBUR], r[MENDIANE], r[PHIRAS],
+            r[THYSTAME]);
+    return snprintf(buf, size, " %d", scalar(field, event));
+}
+
+int event_encode_text(char *buf, size_t size, const event_t *event,
+    const char *text)
+{
+    const char *fields = layouts[event->type].fields;
+    size_t len = snprintf(buf, size, "%s", layouts[event->type].name);
+
+    for (; *fields && len + 2 < size; fields++)
+        len += encode_field(buf + len, size - len - 1, *fields, event, text);
+    if (len + 2 > size)
+        len = size - 2;
+    buf[len] = '\n';
+    buf[len + 1] = '\0';
+    return len + 1;
+}
+
+const char *event_name(int type)
+{
+    return layouts[type].name;
+}
+
+int event_route(int type)
+{
+    return layouts[type].route;
+}
@@ -0,0 +1,45 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** GUI and shared-memory subscriber of the event bus
+*/
+
+#include "gui.h"
+
+static void deliver(server_t *server, const event_t *event, const char *text)
+{
+    char line[GUI_LINE_SIZE];
+    int route = event_route(event->type);
+    unsigned int mask = ~0u;
+
+    if (!(route & EVENT_TO_ALL))
+        mask = interest_mask_at(server, event->x, event->y);
+    if (route & EVENT_TO_MOVE)
+        mask |= interest_mask_at(server, event->old_x, event->old_y);
+    if (!(route & EVENT_TO_SHM && server->shm.base) && !mask)
+        return;
+    event_encode_text(line, sizeof(line), event, text);
+    if (route & EVENT_TO_SHM)
+        shm_world_event(server, line);
+    if (mask)
+        send_gui_mask(server, mask, line);
+}
+
+/*
+** One encoding per event, shared by every GUI and the shm event ring.
+*/
+static void gui_event_sink(void *ctx, const event_t *events, size_t count,
+    const char *text)
+{
+    PROF_FUNC();
+
+    for (size_t i = 0; i < count; i++)
+        deliver(ctx, &events[i], text);
+}
+
+void event_bus_setup(server_t *server)
+{
+    event_bus_subscribe(&server->events, &metrics_events, server);
+    event_bus_subscribe(&server->events, &gui_event_sink, server);
+}
@@ -0,0 +1,52 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** event constructors used at mutation sites
+*/
+
+#include "server.h"
+#include <string.h>
+
+void event_fill_tile(event_t *event, const map_t *map, int x, int y)
+{
+    event->x = x;
+    event->y = y;
+    memcpy(event->items, map->tiles[y][x].resources, sizeof(event->items));
+}
+
+void event_fill_player(event_t *event, const player_t *player)
+{
+    event->id = player->id;
+    event->x = player->x;
+    event->y = player->y;
+    event->dir = player->dir;
+    event->level = player->lvl;
+    memcpy(event->items, player->inventory, sizeof(event->items));
+}
+
+event_t *event_player(server_t *server, event_type_t type,
+    const player_t *player)
+{
+    event_t *event = event_bus_push(&server->events, type);
+
+    event_fill_player(event, player);
+    if (type == EVENT_PNW)
+        event->text = event_bus_text(&server->events, player->team);
+    return event;
+}
+
+void event_move(server_t *server, const player_t *player, int old_x,
+    int old_y)
+{
+    event_t *event = event_player(server, EVENT_PPO, player);
+
+    event->old_x = old_x;
+    event->old_y = old_y;
+}
+
+void event_tile(server_t *server, int x, int y)
+{
+    event_fill_tile(event_bus_push(&server->events, EVENT_BCT),
+        server->map, x, y);
+}
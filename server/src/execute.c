@@ -17,6 +17,8 @@ static void handle_info_commands(server_t *server, player_t *player,
         add_command_with_time(player, original_command, CMD_INVENTORY_TIME);
     if (strcmp(cmd_name, "Connect_nbr") == 0)
         cmd_connect_nbr(server, player);
+    if (strcmp(cmd_name, "Idle") == 0)
+        add_command_with_time(player, original_command, CMD_IDLE_TIME);
 }
 
 static void handle_action_commands(player_t *player, const char *cmd_name,
@@ -32,15 +34,19 @@ static void handle_action_commands(player_t *player, const char *cmd_name,
         add_command_with_time(player, original_command, CMD_TAKE_TIME);
     if (strcmp(cmd_name, "Set") == 0)
         add_command_with_time(player, original_command, CMD_SET_TIME);
-    if (strcmp(cmd_name, "Incantation") == 0)
+    if (strcmp(cmd_name, "Incantation") == 0) {
+        ZAPPY_PROBE(incantation_start, player->id, player->x, player->y,
+            player->lvl);
         add_command_with_time(player, original_command, CMD_INCANTATION_TIME);
+    }
 }
 
 static int is_valid_command(const char *cmd_name)
 {
     const char *valid_commands[] = {
         "Forward", "Right", "Left", "Look", "Inventory", "Broadcast",
-        "Connect_nbr", "Fork", "Eject", "Take", "Set", "Incantation", NULL
+        "Connect_nbr", "Fork", "Eject", "Take", "Set", "Incantation", "Idle",
+        NULL
     };
 
     for (int i = 0; valid_commands[i]; i++) {
@@ -65,21 +71,24 @@ static char *clean_command_copy(const char *original)
 
 void execute_command(server_t *server, player_t *player, char *command)
 {
+    PROF_FUNC();
     char *original_command = clean_command_copy(command);
-    char *cmd_name = strtok(command, " \n");
+    char *save = NULL;
+    char *cmd_name = strtok_r(command, " \n", &save);
 
     if (!cmd_name || !original_command) {
-        dprintf(player->fd, "ko\n");
-        free(original_command);
+        player_reply(server, player, "ko\n");
+        mem_free(MEM_ACTIONS, original_command);
         return;
     }
+    metrics_command(server, cmd_name);
     if (!is_valid_command(cmd_name)) {
-        dprintf(player->fd, "ko\n");
-        free(original_command);
+        player_reply(server, player, "ko\n");
+        mem_free(MEM_ACTIONS, original_command);
         return;
     }
     handle_movement_commands(player, cmd_name, original_command);
     handle_info_commands(server, player, cmd_name, original_command);
     handle_action_commands(player, cmd_name, original_command);
-    free(original_command);
+    mem_free(MEM_ACTIONS, original_command);
 }
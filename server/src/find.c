@@ -6,7 +6,7 @@
 */
 
 #include "commands.h"
-#include "server.h"
+#include "gui.h"
 
 void consume_incantation_resources(server_t *server, player_t *player,
     elevation_requirements_t req)
@@ -19,17 +19,20 @@ void consume_incantation_resources(server_t *server, player_t *player,
     tile->resources[MENDIANE] -= req.mendiane;
     tile->resources[PHIRAS] -= req.phiras;
     tile->resources[THYSTAME] -= req.thystame;
+    world_tile_changed(server, player->x, player->y);
 }
 
 void elevate_all_participants(server_t *server, player_t *initiator)
 {
     for (int i = 0; i < server->player_nb; i++) {
-        if (server->players[i]->x == initiator->x &&
+        if (server->players[i] && server->players[i]->x == initiator->x &&
             server->players[i]->y == initiator->y &&
             server->players[i]->lvl == initiator->lvl) {
             server->players[i]->lvl++;
-            dprintf(server->players[i]->fd, "Current level: %d\n",
+            world_player_changed(server, server->players[i]);
+            player_reply(server, server->players[i], "Current level: %d\n",
                 server->players[i]->lvl);
+            event_player(server, EVENT_PLV, server->players[i]);
         }
     }
 }
@@ -40,37 +43,43 @@ bool validate_incantation_requirements(server_t *server, player_t *player,
     int player_count = count_same_level_players(server, player);
 
     if (player_count < req.required_players) {
-        printf("Incantation failed: need %d players, got %d\n",
+        log_debug("Incantation failed: need %d players, got %d",
             req.required_players, player_count);
         return false;
     }
     if (!check_tile_resources(server, player, req)) {
-        printf("Incantation failed: insufficient resources\n");
+        log_debug("Incantation failed: insufficient resources");
         return false;
     }
     return true;
 }
 
+static void incantation_failed(server_t *s, player_t *p)
+{
+    player_reply(s, p, "ko\n");
+    event_player(s, EVENT_PIE, p)->value = 0;
+    ZAPPY_PROBE(incantation_end, p->id, p->x, p->y, p->lvl, 0);
+}
+
 void cmd_incantation(server_t *s, player_t *p)
 {
+    PROF_FUNC();
     elevation_requirements_t req;
 
     if (p->lvl < 1 || p->lvl > 7) {
-        dprintf(p->fd, "ko\n");
+        player_reply(s, p, "ko\n");
         return;
     }
     req = get_elevation_requirements(p->lvl);
-    dprintf(p->fd, "Elevation underway\n");
+    player_reply(s, p, "Elevation underway\n");
     if (!validate_incantation_requirements(s, p, req)) {
-        dprintf(p->fd, "ko\n");
-        dprintf(s->gui_fd, "pie %d %d %d\n", p->x, p->y, 0);
+        incantation_failed(s, p);
         return;
     }
     consume_incantation_resources(s, p, req);
     elevate_all_participants(s, p);
-    if (s->gui_fd > 0) {
-        dprintf(s->gui_fd, "pic %d %d %d %d\n", p->x, p->y, p->lvl, p->id);
-    }
-    printf("Incantation: %d player level %d\n", req.required_players, p->lvl);
-    dprintf(s->gui_fd, "pie %d %d %d\n", p->x, p->y, 1);
+    event_player(s, EVENT_PIC, p);
+    log_info("Incantation: %d player level %d", req.required_players, p->lvl);
+    event_player(s, EVENT_PIE, p)->value = 1;
+    ZAPPY_PROBE(incantation_end, p->id, p->x, p->y, p->lvl, 1);
 }
@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** commands sent by GUI clients
+*/
+
+#include "gui.h"
+#include <stdio.h>
+#include <string.h>
+
+static void gui_cmd_vsub(server_t *server, int i, const char *args)
+{
+    gui_view_t view = {0};
+
+    if (!parse_view_command(args, &view)) {
+        dprintf(server->pfds[i].fd, "sbp\n");
+        return;
+    }
+    gui_subscribe_view(server, i, view);
+}
+
+static const gui_command_t gui_commands[] = {
+    {"vsub", &gui_cmd_vsub},
+    {"rsh", &gui_cmd_rsh},
+    {"msz", &gui_cmd_msz},
+    {"bct", &gui_cmd_bct},
+    {"mct", &gui_cmd_mct},
+    {"tna", &gui_cmd_tna},
+    {"ppo", &gui_cmd_ppo},
+    {"plv", &gui_cmd_plv},
+    {"pin", &gui_cmd_pin},
+    {"sgt", &gui_cmd_sgt},
+    {"sst", &gui_cmd_sst},
+    {NULL, NULL}
+};
+
+void handle_gui_command(server_t *server, int i, const char *buffer)
+{
+    size_t len = strcspn(buffer, " \r\n");
+    const char *args = buffer + len;
+
+    while (*args == ' ')
+        args++;
+    server->metrics.live.gui_commands++;
+    for (int c = 0; gui_commands[c].name; c++) {
+        if (strlen(gui_commands[c].name) == len &&
+            strncmp(buffer, gui_commands[c].name, len) == 0) {
+            gui_commands[c].handler(server, i, args);
+            return;
+        }
+    }
+    dprintf(server->pfds[i].fd, "suc\n");
+}
@@ -0,0 +1,40 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** GUI protocol lines for snapshots, built from the event encoder
+*/
+
+#include "gui.h"
+#include <stdio.h>
+
+int format_bct(char *buf, map_t *map, int x, int y)
+{
+    event_t event = {.type = EVENT_BCT, .text = EVENT_NO_TEXT};
+
+    event_fill_tile(&event, map, x, y);
+    return event_encode_text(buf, GUI_LINE_SIZE, &event, NULL);
+}
+
+int format_pin(char *buf, player_t *player)
+{
+    event_t event = {.type = EVENT_PIN, .text = EVENT_NO_TEXT};
+
+    event_fill_player(&event, player);
+    return event_encode_text(buf, GUI_LINE_SIZE, &event, NULL);
+}
+
+int format_ppo(char *buf, player_t *player)
+{
+    event_t event = {.type = EVENT_PPO, .text = EVENT_NO_TEXT};
+
+    event_fill_player(&event, player);
+    return event_encode_text(buf, GUI_LINE_SIZE, &event, NULL);
+}
+
+void send_gui_tile_content(server_t *server, int x, int y)
+{
+    if (budget_defer_tile(server, x, y))
+        return;
+    event_tile(server, x, y);
+}
@@ -0,0 +1,57 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** GUI team and player queries
+*/
+
+#include "gui.h"
+#include <stdio.h>
+#include <unistd.h>
+
+void gui_cmd_tna(server_t *server, int i, const char *args)
+{
+    (void)args;
+    for (int t = 0; t < server->config->team_nb; t++)
+        dprintf(server->pfds[i].fd, "tna %s\n", server->config->teams[t].name);
+}
+
+static player_t *find_player_arg(server_t *server, int i, const char *args)
+{
+    int id = -1;
+
+    if (*args == '#')
+        args++;
+    if (sscanf(args, "%d", &id) != 1 || id < 0 || id >= server->player_nb ||
+        !server->players[id]) {
+        dprintf(server->pfds[i].fd, "sbp\n");
+        return NULL;
+    }
+    return server->players[id];
+}
+
+void gui_cmd_ppo(server_t *server, int i, const char *args)
+{
+    char line[GUI_LINE_SIZE];
+    player_t *player = find_player_arg(server, i, args);
+
+    if (player)
+        write(server->pfds[i].fd, line, format_ppo(line, player));
+}
+
+void gui_cmd_plv(server_t *server, int i, const char *args)
+{
+    player_t *player = find_player_arg(server, i, args);
+
+    if (player)
+        dprintf(server->pfds[i].fd, "plv %d %d\n", player->id, player->lvl);
+}
+
+void gui_cmd_pin(server_t *server, int i, const char *args)
+{
+    char line[GUI_LINE_SIZE];
+    player_t *player = find_player_arg(server, i, args);
+
+    if (player)
+        write(server->pfds[i].fd, line, format_pin(line, player));
+}
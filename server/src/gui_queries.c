@@ -0,0 +1,51 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** GUI map and time queries
+*/
+
+#include "gui.h"
+#include <stdio.h>
+#include <unistd.h>
+
+void gui_cmd_msz(server_t *server, int i, const char *args)
+{
+    (void)args;
+    dprintf(server->pfds[i].fd, "msz %d %d\n", server->map->width,
+        server->map->height);
+}
+
+void gui_cmd_bct(server_t *server, int i, const char *args)
+{
+    char line[GUI_LINE_SIZE];
+    int x = 0;
+    int y = 0;
+
+    if (sscanf(args, "%d %d", &x, &y) != 2 || x < 0 || y < 0 ||
+        x >= server->map->width || y >= server->map->height) {
+        dprintf(server->pfds[i].fd, "sbp\n");
+        return;
+    }
+    write(server->pfds[i].fd, line, format_bct(line, server->map, x, y));
+}
+
+void gui_cmd_mct(server_t *server, int i, const char *args)
+{
+    (void)args;
+    send_mct(server, server->pfds[i].fd);
+}
+
+void gui_cmd_sgt(server_t *server, int i, const char *args)
+{
+    (void)args;
+    dprintf(server->pfds[i].fd, "sgt %d\n", server->config->freq);
+}
+
+void gui_cmd_sst(server_t *server, int i, const char *args)
+{
+    int freq = 0;
+
+    if (sscanf(args, "%d", &freq) != 1 || !set_frequency(server, freq))
+        dprintf(server->pfds[i].fd, "sbp\n");
+}
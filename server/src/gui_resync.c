@@ -0,0 +1,72 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** rsync-style GUI resync from region hashes
+*/
+
+#include "gui.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <inttypes.h>
+
+static void send_region_tiles(server_t *server, int fd, int col, int row)
+{
+    char line[GUI_LINE_SIZE];
+
+    for (int y = row * SYNC_REGION; y < (row + 1) * SYNC_REGION &&
+        y < server->map->height; y++) {
+        for (int x = col * SYNC_REGION; x < (col + 1) * SYNC_REGION &&
+            x < server->map->width; x++)
+            write(fd, line, format_bct(line, server->map, x, y));
+    }
+}
+
+static void send_region_players(server_t *server, int fd, int region)
+{
+    char line[GUI_LINE_SIZE];
+    player_t *player = NULL;
+
+    for (int i = 0; i < server->player_nb; i++) {
+        player = server->players[i];
+        if (!player || player->region != region)
+            continue;
+        dprintf(fd, "pnw %d %d %d %d %d %s\n", player->id, player->x,
+            player->y, player->dir + 1, player->lvl, player->team);
+        write(fd, line, format_pin(line, player));
+    }
+}
+
+static void send_region(server_t *server, int fd, int region)
+{
+    int col = region % server->sync.cols;
+    int row = region / server->sync.cols;
+
+    dprintf(fd, "rbg %d\n", region);
+    send_region_tiles(server, fd, col, row);
+    send_region_players(server, fd, region);
+    dprintf(fd, "ren %d %016" PRIx64 "\n", region,
+        server->sync.hashes[region]);
+}
+
+void gui_cmd_rsh(server_t *server, int i, const char *args)
+{
+    int count = server->sync.cols * server->sync.rows;
+    char *end = NULL;
+    long region = 0;
+    uint64_t hash = 0;
+
+    while (args && *args && server->sync.hashes) {
+        region = strtol(args, &end, 10);
+        if (end == args)
+            break;
+        hash = strtoull(end, (char **)&args, 16);
+        if (region < 0 || region >= count) {
+            dprintf(server->pfds[i].fd, "sbp\n");
+            continue;
+        }
+        if (hash != server->sync.hashes[region])
+            send_region(server, server->pfds[i].fd, region);
+    }
+}
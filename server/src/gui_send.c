@@ -0,0 +1,29 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** GUI fan-out filtered by viewport interest
+*/
+
+#include "gui.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+void send_gui_mask(server_t *server, unsigned int mask, const char *line)
+{
+    metrics_t *live = &server->metrics.live;
+    uint64_t start_ns = metrics_now_ns();
+    size_t len = strlen(line);
+
+    for (int i = 1; mask && i < NB_CONNECTION + 1; i++) {
+        if (!(mask & (1u << i)) || server->pfds[i].fd == FD_NULL ||
+            server->clients[i].type != CLIENT_GUI)
+            continue;
+        write(server->pfds[i].fd, line, len);
+        live->gui_lines++;
+        live->gui_bytes += len;
+    }
+    hist_record(&live->gui_fanout_ns, metrics_now_ns() - start_ns);
+    ZAPPY_PROBE(gui_flush, mask, len, metrics_now_ns() - start_ns);
+}
@@ -0,0 +1,73 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** entry snapshots and exit notices for interest cells
+*/
+
+#include "gui.h"
+#include <stdio.h>
+#include <unistd.h>
+
+static void send_cell_tiles(server_t *server, int fd, int col, int row)
+{
+    char line[GUI_LINE_SIZE];
+    int len = 0;
+
+    for (int y = row * INTEREST_CELL; y < (row + 1) * INTEREST_CELL &&
+        y < server->map->height; y++) {
+        for (int x = col * INTEREST_CELL; x < (col + 1) * INTEREST_CELL &&
+            x < server->map->width; x++) {
+            len = format_bct(line, server->map, x, y);
+            write(fd, line, len);
+        }
+    }
+}
+
+static void send_cell_players(server_t *server, int fd, int col, int row)
+{
+    char line[GUI_LINE_SIZE];
+    player_t *player = NULL;
+    int len = 0;
+
+    for (int i = 0; i < server->player_nb; i++) {
+        player = server->players[i];
+        if (!player || player->x / INTEREST_CELL != col ||
+            player->y / INTEREST_CELL != row)
+            continue;
+        dprintf(fd, "pnw %d %d %d %d %d %s\n", player->id, player->x,
+            player->y, player->dir + 1, player->lvl, player->team);
+        len = format_pin(line, player);
+        write(fd, line, len);
+    }
+}
+
+void send_cell_snapshot(server_t *server, int i, int col, int row)
+{
+    int fd = server->pfds[i].fd;
+
+    if (fd == FD_NULL)
+        return;
+    send_cell_tiles(server, fd, col, row);
+    send_cell_players(server, fd, col, row);
+}
+
+/*
+** The GUI stops receiving ppo for a cell once it leaves the view, so it
+** is told to forget the players it last saw there; the entry snapshot's
+** pnw brings them back.
+*/
+void send_cell_exit(server_t *server, int i, int col, int row)
+{
+    int fd = server->pfds[i].fd;
+    int x = col * INTEREST_CELL;
+    int y = row * INTEREST_CELL;
+
+    if (fd == FD_NULL)
+        return;
+    dprintf(fd, "vex %d %d %d %d\n", x, y,
+        server->map->width - x < INTEREST_CELL ?
+        server->map->width - x : INTEREST_CELL,
+        server->map->height - y < INTEREST_CELL ?
+        server->map->height - y : INTEREST_CELL);
+}
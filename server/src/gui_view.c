@@ -0,0 +1,89 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** GUI viewport subscriptions
+*/
+
+#include "gui.h"
+#include <stdio.h>
+#include <string.h>
+
+bool parse_view_command(const char *args, gui_view_t *view)
+{
+    int read = 0;
+
+    if (!args)
+        return false;
+    read = sscanf(args, "%d %d %d %d %d", &view->x, &view->y,
+        &view->width, &view->height, &view->margin);
+    if (read < 4)
+        return false;
+    if (read == 4 || view->margin < 0)
+        view->margin = 0;
+    view->active = view->width > 0 && view->height > 0;
+    return true;
+}
+
+static void mark_span(bool *cells, int start, int len, int size)
+{
+    if (len >= size) {
+        for (int k = 0; k < size; k++)
+            cells[k / INTEREST_CELL] = true;
+        return;
+    }
+    for (int k = start; k < start + len; k++)
+        cells[((k % size + size) % size) / INTEREST_CELL] = true;
+}
+
+static void update_cell(server_t *server, int i, int cell, bool wanted)
+{
+    unsigned int bit = 1u << i;
+    unsigned int *mask = &server->interest.masks[cell];
+    bool had = *mask & bit;
+    bool seen = had || (server->interest.global_mask & bit);
+    int col = cell % server->interest.cols;
+    int row = cell / server->interest.cols;
+
+    if (wanted && !had && server->clients[i].view.active)
+        send_cell_snapshot(server, i, col, row);
+    if (!wanted && seen)
+        send_cell_exit(server, i, col, row);
+    if (wanted)
+        *mask |= bit;
+    else
+        *mask &= ~bit;
+}
+
+static void apply_view_cells(server_t *server, int i, bool *cols, bool *rows)
+{
+    interest_grid_t *grid = &server->interest;
+
+    for (int r = 0; r < grid->rows; r++) {
+        for (int c = 0; c < grid->cols; c++)
+            update_cell(server, i, r * grid->cols + c, cols[c] && rows[r]);
+    }
+}
+
+void gui_subscribe_view(server_t *server, int i, gui_view_t view)
+{
+    interest_grid_t *grid = &server->interest;
+    bool *cols = mem_calloc(MEM_GUI, grid->cols, sizeof(bool));
+    bool *rows = mem_calloc(MEM_GUI, grid->rows, sizeof(bool));
+
+    if (!view.active || !cols || !rows || !grid->masks) {
+        mem_free(MEM_GUI, cols);
+        mem_free(MEM_GUI, rows);
+        gui_unsubscribe_view(server, i);
+        return;
+    }
+    mark_span(cols, view.x - view.margin, view.width + 2 * view.margin,
+        server->map->width);
+    mark_span(rows, view.y - view.margin, view.height + 2 * view.margin,
+        server->map->height);
+    apply_view_cells(server, i, cols, rows);
+    grid->global_mask &= ~(1u << i);
+    server->clients[i].view = view;
+    mem_free(MEM_GUI, cols);
+    mem_free(MEM_GUI, rows);
+}
@@ -5,7 +5,7 @@
 ** handle_client
 */
 
-#include "server.h"
+#include "gui.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -18,62 +18,64 @@ int read_client_data(server_t *server, int i, char *buffer,
     int read_size = 0;
 
     if (server->pfds[i].fd == FD_NULL) {
-        fprintf(stderr, "Invalid Reading %d\n", server->pfds[i].fd);
+        log_warn("Invalid Reading %d", server->pfds[i].fd);
         return -1;
     }
     read_size = read(server->pfds[i].fd, buffer, buffer_size - 1);
     if (read_size <= 0) {
-        perror("Error in reading");
+        log_info("Connection closed on fd %d", server->pfds[i].fd);
+        record_input(server, RECORD_READ_CLOSED, i, NULL);
         close(server->pfds[i].fd);
         server->pfds[i].fd = FD_NULL;
         return -1;
     }
     buffer[read_size] = '\0';
-    printf("Message de fd %d : %s", server->pfds[i].fd, buffer);
+    log_trace("Message de fd %d : %s", server->pfds[i].fd, buffer);
     return read_size;
 }
 
-void send_player_to_gui(int gui_fd, player_t *player)
+void send_player_to_gui(server_t *server, player_t *player)
 {
-    if (gui_fd == -1 || !player)
+    if (!player)
         return;
-    dprintf(gui_fd, "pnw %d %d %d %d %d %s\n",
-        player->id, player->x, player->y,
-        player->dir + 1, player->lvl, player->team);
-    dprintf(gui_fd, "pin %d %d %d %d %d %d %d %d %d %d\n",
-        player->id, player->x, player->y,
-        player->inventory[FOOD],
-        player->inventory[LINEMATE],
-        player->inventory[DERAUMERE],
-        player->inventory[SIBUR],
-        player->inventory[MENDIANE],
-        player->inventory[PHIRAS],
-        player->inventory[THYSTAME]);
+    event_player(server, EVENT_PNW, player);
+    event_player(server, EVENT_PIN, player);
 }
 
-void register_player(server_t *server, int client_index,
-    team_t *team, const char *team_name)
+player_t *spawn_player(server_t *server, team_t *team, int fd)
+{
+    player_t *player = NULL;
+
+    if (server->player_nb >= MAX_PLAYERS)
+        return NULL;
+    player = create_player(server->player_nb, fd, team->name, server);
+    if (!player)
+        return NULL;
+    server->players[server->player_nb] = player;
+    world_player_changed(server, player);
+    server->player_nb++;
+    team->actual_players++;
+    send_player_to_gui(server, player);
+    ZAPPY_PROBE(player_spawn, player->id, player->x, player->y,
+        player->team);
+    return player;
+}
+
+void register_player(server_t *server, int client_index, team_t *team)
 {
     int fd = server->pfds[client_index].fd;
-    int available_slot = 0;
-    player_t *player = create_player(server->player_nb, fd, team_name,
-        server->map);
+    player_t *player = spawn_player(server, team, fd);
 
     if (!player) {
         write(fd, "ko\n", 3);
         return;
     }
-    server->players[server->player_nb] = player;
-    server->player_nb++;
     server->clients[client_index].type = CLIENT_IA;
     server->clients[client_index].player = player;
-    team->actual_players++;
-    available_slot = team->max_players - team->actual_players;
-    dprintf(fd, "%d\n", available_slot);
+    dprintf(fd, "%d\n", team->max_players - team->actual_players);
     dprintf(fd, "%d %d\n", server->map->width, server->map->height);
-    printf("Player registered: id=%d, fd=%d, team=%s\n", player->id,
+    log_info("Player registered: id=%d, fd=%d, team=%s", player->id,
         player->fd, player->team);
-    send_player_to_gui(server->gui_fd, player);
 }
 
 team_t *find_team(const char *name, server_config_t *config)
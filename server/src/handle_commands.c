@@ -7,6 +7,7 @@
 
 #include "server.h"
 #include "commands.h"
+#include "gui.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -21,7 +22,7 @@ static char *create_clean_command_copy(const char *buffer)
     char *newline_pos = NULL;
     size_t len = strlen(buffer) + 1;
 
-    command_copy = malloc(len);
+    command_copy = mem_alloc(MEM_NETWORK, len);
     if (!command_copy)
         return NULL;
     strncpy(command_copy, buffer, len - 1);
@@ -37,34 +38,32 @@ static void handle_ia_command(server_t *server, int i, const char *buffer)
     char *command_copy = create_clean_command_copy(buffer);
 
     if (!command_copy) {
-        printf("Memory allocation failed for IA command\n");
+        log_error("Memory allocation failed for IA command");
         write(server->pfds[i].fd, "ko\n", 3);
         return;
     }
-    printf("Executing IA command: '%s' for player %d\n",
+    log_debug("Executing IA command: '%s' for player %d",
         command_copy, server->clients[i].player->id);
+    server->clients[i].player->read_ns = server->clients[i].read_ns;
+    ZAPPY_PROBE(command_ingress, server->clients[i].player->id,
+        command_copy);
     execute_command(server, server->clients[i].player, command_copy);
-    free(command_copy);
-}
-
-static void handle_gui_command(const char *buffer)
-{
-    printf("GUI command received: %s", buffer);
+    mem_free(MEM_NETWORK, command_copy);
 }
 
 static void handle_unknown_client_state(server_t *server, int i)
 {
-    printf("Unknown client state: type=%d\n", server->clients[i].type);
+    log_warn("Unknown client state: type=%d", server->clients[i].type);
     write(server->pfds[i].fd, "ko\n", 3);
 }
 
 void handle_client_message(server_t *server, int i, const char *buffer,
     server_config_t *config)
 {
-    printf("Client %d (type=%d): received '%s'\n",
+    log_trace("Client %d (type=%d): received '%s'",
         i, server->clients[i].type, buffer);
     if (strncmp(buffer, "GRAPHIC", 7) == 0) {
-        handle_graphic_client_registration(server, i);
+        handle_graphic_client_registration(server, i, buffer);
         return;
     }
     if (server->clients[i].type == -1) {
@@ -76,7 +75,7 @@ void handle_client_message(server_t *server, int i, const char *buffer,
         return;
     }
     if (server->clients[i].type == CLIENT_GUI) {
-        handle_gui_command(buffer);
+        handle_gui_command(server, i, buffer);
         return;
     }
     handle_unknown_client_state(server, i);
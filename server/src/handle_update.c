@@ -7,6 +7,7 @@
 
 #include "server.h"
 #include "commands.h"
+#include "gui.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -21,7 +22,7 @@ static char *create_clean_team_name(const char *buffer)
     size_t len = strlen(buffer) + 1;
     char *newline_pos = NULL;
 
-    team_name = malloc(len);
+    team_name = mem_alloc(MEM_NETWORK, len);
     if (!team_name)
         return NULL;
     strncpy(team_name, buffer, len - 1);
@@ -36,12 +37,12 @@ static int validate_team_availability(team_t *team, const char *team_name,
     int fd)
 {
     if (!team) {
-        printf("Team '%s' not found\n", team_name);
+        log_warn("Team '%s' not found", team_name);
         write(fd, "ko\n", 3);
         return 0;
     }
     if (team->actual_players >= team->max_players) {
-        printf("Team '%s' is full\n", team_name);
+        log_warn("Team '%s' is full", team_name);
         write(fd, "ko\n", 3);
         return 0;
     }
@@ -56,23 +57,30 @@ void handle_team_command(server_t *server, server_config_t *config,
     team_t *team = NULL;
 
     if (!team_name) {
-        printf("Memory allocation failed for team name\n");
+        log_error("Memory allocation failed for team name");
         write(fd, "ko\n", 3);
         return;
     }
-    printf("Team command received: '%s'\n", team_name);
+    log_debug("Team command received: '%s'", team_name);
     team = find_team(team_name, config);
-    if (validate_team_availability(team, team_name, fd)) {
-        register_player(server, client_index, team, team_name);
-    }
-    free(team_name);
+    if (team && checkpoint_adopt(server, client_index, team))
+        log_debug("Team %s: restored player reattached", team_name);
+    else if (validate_team_availability(team, team_name, fd))
+        register_player(server, client_index, team);
+    mem_free(MEM_NETWORK, team_name);
 }
 
-void handle_graphic_client_registration(server_t *server, int i)
+void handle_graphic_client_registration(server_t *server, int i,
+    const char *buffer)
 {
     server->clients[i].type = CLIENT_GUI;
     server->gui_fd = server->pfds[i].fd;
+    gui_unsubscribe_view(server, i);
     write(server->pfds[i].fd, "WELCOME\n", 8);
-    printf("Client %d registered as GUI\n", i);
-    send_data_gui(server, server->gui_fd, server->config);
+    log_info("Client %d registered as GUI", i);
+    if (strstr(buffer, "RESYNC"))
+        send_resync_header(server, server->gui_fd, server->config);
+    else
+        send_data_gui(server, server->gui_fd, server->config);
+    dprintf(server->gui_fd, "rgs %d\n", SYNC_REGION);
 }
@@ -0,0 +1,66 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** log-linear histogram
+*/
+
+#include "metrics.h"
+
+static int bucket_index(uint64_t value)
+{
+    int msb = 0;
+    int shift = 0;
+
+    if (value < HIST_SUB)
+        return value;
+    msb = 63 - __builtin_clzll(value);
+    shift = msb - HIST_SUB_BITS;
+    return (shift + 1) * HIST_SUB + ((value >> shift) & (HIST_SUB - 1));
+}
+
+void hist_record(hist_t *hist, uint64_t value)
+{
+    hist->counts[bucket_index(value)]++;
+    hist->total++;
+    hist->sum += value;
+    if (value > hist->max)
+        hist->max = value;
+}
+
+uint64_t hist_bucket_low(int index)
+{
+    int shift = index / HIST_SUB - 1;
+
+    if (index < HIST_SUB)
+        return index;
+    return (uint64_t)(HIST_SUB + index % HIST_SUB) << shift;
+}
+
+uint64_t hist_quantile(const hist_t *hist, double quantile)
+{
+    uint64_t wanted = (uint64_t)(quantile * hist->total);
+    uint64_t seen = 0;
+    uint64_t high = 0;
+
+    for (int i = 0; i < HIST_BUCKETS; i++) {
+        seen += hist->counts[i];
+        if (seen <= wanted || !hist->counts[i])
+            continue;
+        high = i + 1 < HIST_BUCKETS ? hist_bucket_low(i + 1) - 1 : hist->max;
+        return high < hist->max ? high : hist->max;
+    }
+    return hist->max;
+}
+
+uint64_t hist_count_below(const hist_t *hist, uint64_t limit)
+{
+    uint64_t seen = 0;
+
+    for (int i = 0; i < HIST_BUCKETS - 1; i++) {
+        if (hist_bucket_low(i + 1) - 1 > limit)
+            break;
+        seen += hist->counts[i];
+    }
+    return seen;
+}
@@ -0,0 +1,48 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** spatial interest grid for GUI viewports
+*/
+
+#include "gui.h"
+#include <string.h>
+
+void init_interest(interest_grid_t *grid, int width, int height)
+{
+    grid->cols = (width + INTEREST_CELL - 1) / INTEREST_CELL;
+    grid->rows = (height + INTEREST_CELL - 1) / INTEREST_CELL;
+    grid->masks = mem_calloc(MEM_GUI, grid->cols * grid->rows,
+        sizeof(unsigned int));
+    grid->global_mask = 0;
+}
+
+void free_interest(interest_grid_t *grid)
+{
+    mem_free(MEM_GUI, grid->masks);
+    grid->masks = NULL;
+}
+
+unsigned int interest_mask_at(server_t *server, int x, int y)
+{
+    interest_grid_t *grid = &server->interest;
+
+    if (!grid->masks)
+        return grid->global_mask;
+    return grid->masks[(y / INTEREST_CELL) * grid->cols + x / INTEREST_CELL]
+        | grid->global_mask;
+}
+
+void gui_unsubscribe_view(server_t *server, int i)
+{
+    interest_grid_t *grid = &server->interest;
+    unsigned int bit = 1u << i;
+
+    for (int c = 0; grid->masks && c < grid->cols * grid->rows; c++)
+        grid->masks[c] &= ~bit;
+    server->clients[i].view.active = false;
+    if (server->clients[i].type == CLIENT_GUI)
+        grid->global_mask |= bit;
+    else
+        grid->global_mask &= ~bit;
+}
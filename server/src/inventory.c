@@ -6,12 +6,12 @@
 */
 
 #include "commands.h"
-#include "server.h"
+#include "gui.h"
 
 char *build_inventory_response(player_t *player)
 {
     size_t needed_size = calculate_total_size(player);
-    char *response = malloc(needed_size);
+    char *response = mem_alloc(MEM_RESPONSES, needed_size);
     bool first = true;
 
     if (!response)
@@ -19,7 +19,7 @@ char *build_inventory_response(player_t *player)
     strcpy(response, "[");
     for (int i = 0; i < RESOURCE_COUNT; i++) {
         if (!process_single_item(player, i, response, &first)) {
-            free(response);
+            mem_free(MEM_RESPONSES, response);
             return NULL;
         }
     }
@@ -29,63 +29,59 @@ char *build_inventory_response(player_t *player)
 
 void cmd_inventory(server_t *server, player_t *player)
 {
+    PROF_FUNC();
     char *response = build_inventory_response(player);
 
     if (!response) {
-        dprintf(player->fd, "ko\n");
+        player_reply(server, player, "ko\n");
         return;
     }
-    dprintf(player->fd, "%s\n", response);
-    send_gui(server, "pin %d %d %d %d %d %d %d %d %d %d\n",
-        player->id, player->x, player->y,
-        player->inventory[FOOD],
-        player->inventory[LINEMATE],
-        player->inventory[DERAUMERE],
-        player->inventory[SIBUR],
-        player->inventory[MENDIANE],
-        player->inventory[PHIRAS],
-        player->inventory[THYSTAME]);
-    free(response);
+    player_reply(server, player, "%s\n", response);
+    event_player(server, EVENT_PIN, player);
+    mem_free(MEM_RESPONSES, response);
 }
 
 void cmd_broadcast(server_t *server, player_t *player, char *args)
 {
+    PROF_FUNC();
     int direction = 0;
 
     for (int i = 0; i < server->player_nb; i++) {
-        if (server->players[i] != player) {
-            dprintf(server->players[i]->fd, "message %d,%s\n", direction,
-                args);
+        if (server->players[i] && server->players[i] != player) {
+            player_reply(server, server->players[i], "message %d,%s\n",
+                direction, args);
         }
-        if (server->gui_fd != -1)
-            dprintf(server->gui_fd, "pbc %d %s\n", player->id, args);
     }
-    dprintf(player->fd, "ok\n");
+    event_player(server, EVENT_PBC, player)->text =
+        event_bus_text(&server->events, args ? args : "");
+    player_reply(server, player, "ok\n");
 }
 
 void cmd_connect_nbr(server_t *server, player_t *player)
 {
+    PROF_FUNC();
     team_t *team = find_team(player->team, server->config);
     int available_slots = 0;
 
     if (team) {
         available_slots = team->max_players - team->actual_players;
-        dprintf(player->fd, "%d\n", available_slots);
+        player_reply(server, player, "%d\n", available_slots);
     } else {
-        dprintf(player->fd, "0\n");
+        player_reply(server, player, "0\n");
     }
+    metrics_latency(server, "Connect_nbr", player->read_ns, 0);
 }
 
 void cmd_fork(server_t *server, player_t *player)
 {
+    PROF_FUNC();
     team_t *team = find_team(player->team, server->config);
 
     if (team) {
         team->eggs_available++;
-        dprintf(player->fd, "ok\n");
-        if (server->gui_fd != -1)
-            dprintf(server->gui_fd, "pfk %d\n", player->id);
+        player_reply(server, player, "ok\n");
+        event_player(server, EVENT_PFK, player);
     } else {
-        dprintf(player->fd, "ko\n");
+        player_reply(server, player, "ko\n");
     }
 }
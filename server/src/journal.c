@@ -0,0 +1,104 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** journal file lifetime
+*/
+
+#include "server.h"
+#include <fcntl.h>
+#include <limits.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+static int open_files(journal_t *journal, const char *path)
+{
+    char index_path[PATH_MAX];
+
+    journal->map = MAP_FAILED;
+    snprintf(index_path, sizeof(index_path), "%s.idx", path);
+    journal->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (journal->fd < 0)
+        return -1;
+    journal->index = fopen(index_path, "wb");
+    journal->mapped = JOURNAL_CHUNK;
+    if (!journal->index || ftruncate(journal->fd, journal->mapped) < 0)
+        return -1;
+    journal->map = mmap(NULL, journal->mapped, PROT_READ | PROT_WRITE,
+        MAP_SHARED, journal->fd, 0);
+    return journal->map == MAP_FAILED ? -1 : 0;
+}
+
+/*
+** The ring must hold a whole keyframe, which is written in one go.
+*/
+static size_t ring_size_for(server_t *server)
+{
+    size_t needed = journal_keyframe_size(server) * 2;
+    size_t size = JOURNAL_RING_MIN;
+
+    while (size < needed)
+        size <<= 1;
+    return size;
+}
+
+static void write_header(server_t *server, server_config_t *config,
+    journal_t *journal)
+{
+    journal_header_t header = {JOURNAL_MAGIC, JOURNAL_VERSION,
+        server->map->width, server->map->height, config->freq,
+        JOURNAL_KEYFRAME_TICKS, JOURNAL_INDEX_TICKS,
+        sizeof(journal_header_t)};
+
+    memcpy(journal->map, &header, sizeof(header));
+    journal->length = sizeof(header);
+    journal->scanned = sizeof(header);
+    journal->digest_tick = server->tick;
+}
+
+int journal_open(server_t *server, server_config_t *config)
+{
+    const char *path = config->journal_path;
+    journal_t *journal = mem_calloc(MEM_EVENTS, 1, sizeof(journal_t));
+
+    if (!journal)
+        return -1;
+    server->journal = journal;
+    if (open_files(journal, path) < 0) {
+        log_error("Cannot open journal %s", path);
+        return -1;
+    }
+    write_header(server, config, journal);
+    journal->ring_size = ring_size_for(server);
+    journal->ring = mem_alloc(MEM_EVENTS, journal->ring_size);
+    atomic_store(&journal->running, journal->ring != NULL);
+    if (!journal->ring || pthread_create(&journal->thread, NULL,
+        &journal_writer, journal) != 0)
+        return -1;
+    event_bus_subscribe(&server->events, &journal_sink, server);
+    log_info("Journal: %s (ring %lu bytes)", path, journal->ring_size);
+    return 0;
+}
+
+void journal_close(server_t *server)
+{
+    journal_t *journal = server->journal;
+
+    if (!journal)
+        return;
+    if (atomic_exchange(&journal->running, false))
+        pthread_join(journal->thread, NULL);
+    if (journal->map != MAP_FAILED)
+        munmap(journal->map, journal->mapped);
+    if (journal->fd >= 0 && ftruncate(journal->fd, journal->length) == 0)
+        log_info("Journal: %lu bytes, %lu records dropped",
+            journal->length, atomic_load(&journal->dropped));
+    if (journal->fd >= 0)
+        close(journal->fd);
+    if (journal->index)
+        fclose(journal->index);
+    mem_free(MEM_EVENTS, journal->ring);
+    mem_free(MEM_EVENTS, journal);
+    server->journal = NULL;
+}
@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** journal record encoding, shared with zappy_journal
+*/
+
+#include "journal.h"
+#include <string.h>
+
+bool journal_has_items(int type)
+{
+    return type == EVENT_PIN || type == EVENT_BCT;
+}
+
+bool journal_has_text(int type)
+{
+    return type == EVENT_PNW || type == EVENT_PBC;
+}
+
+static int32_t record_value(const event_t *event)
+{
+    if (event->type == EVENT_PLV || event->type == EVENT_PIC ||
+        event->type == EVENT_PNW)
+        return event->level;
+    return event->value;
+}
+
+/*
+** buf must hold JOURNAL_RECORD_MAX bytes.
+*/
+size_t journal_encode(uint8_t *buf, const event_t *event, const char *text,
+    uint32_t tick)
+{
+    journal_record_t *record = (journal_record_t *)buf;
+    size_t size = sizeof(journal_record_t);
+    size_t len = 0;
+
+    *record = (journal_record_t){0, event->type, event->dir, tick,
+        event->id, event->x, event->y, record_value(event)};
+    if (journal_has_items(event->type)) {
+        memcpy(buf + size, event->items, sizeof(event->items));
+        size += sizeof(event->items);
+    }
+    if (journal_has_text(event->type)) {
+        len = text ? strnlen(text, JOURNAL_TEXT_MAX) : 0;
+        memcpy(buf + size, text ? text : "", len);
+        buf[size + len] = '\0';
+        size += len + 1;
+    }
+    record->size = (size + 3) & ~(size_t)3;
+    memset(buf + size, 0, record->size - size);
+    return record->size;
+}
+
+const char *journal_decode(const journal_record_t *record, event_t *event)
+{
+    const uint8_t *payload = (const uint8_t *)(record + 1);
+
+    memset(event, 0, sizeof(event_t));
+    event->type = record->type;
+    event->id = record->id;
+    event->x = record->x;
+    event->y = record->y;
+    event->dir = record->dir;
+    event->level = record->value;
+    event->value = record->value;
+    event->text = EVENT_NO_TEXT;
+    if (journal_has_items(record->type)) {
+        memcpy(event->items, payload, sizeof(event->items));
+        payload += sizeof(event->items);
+    }
+    if (!journal_has_text(record->type))
+        return NULL;
+    event->text = 0;
+    return (const char *)payload;
+}
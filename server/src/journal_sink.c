@@ -0,0 +1,47 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** event bus subscriber feeding the journal ring
+*/
+
+#include "server.h"
+#include <string.h>
+
+bool journal_append(journal_t *journal, const void *data, size_t size)
+{
+    size_t head = atomic_load_explicit(&journal->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&journal->tail, memory_order_acquire);
+    size_t at = head & (journal->ring_size - 1);
+    size_t first = size < journal->ring_size - at ? size :
+        journal->ring_size - at;
+
+    if (journal->ring_size - (head - tail) < size) {
+        atomic_fetch_add(&journal->dropped, 1);
+        return false;
+    }
+    memcpy(journal->ring + at, data, first);
+    memcpy(journal->ring, (const uint8_t *)data + first, size - first);
+    atomic_store_explicit(&journal->head, head + size, memory_order_release);
+    return true;
+}
+
+void journal_write_event(journal_t *journal, const event_t *event,
+    const char *text, unsigned long tick)
+{
+    uint8_t buf[JOURNAL_RECORD_MAX];
+
+    journal_append(journal, buf, journal_encode(buf, event, text, tick));
+}
+
+void journal_sink(void *ctx, const event_t *events, size_t count,
+    const char *text)
+{
+    server_t *server = ctx;
+    journal_t *journal = server->journal;
+
+    for (size_t i = 0; i < count; i++)
+        journal_write_event(journal, &events[i],
+            events[i].text == EVENT_NO_TEXT ? NULL : text + events[i].text,
+            server->tick);
+}
@@ -0,0 +1,88 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** per tick journal records: keyframes and world digest
+*/
+
+#include "server.h"
+
+size_t journal_keyframe_size(server_t *server)
+{
+    return sizeof(journal_record_t) * (1 + server->player_nb * 2 +
+        server->map->width * server->map->height) + (sizeof(int32_t) *
+        RESOURCE_COUNT + 4) * (server->player_nb + server->map->width *
+        server->map->height) + (JOURNAL_TEXT_MAX + 4) * server->player_nb;
+}
+
+static void write_players(server_t *server, journal_t *journal)
+{
+    event_t event = {0};
+
+    for (int i = 0; i < server->player_nb; i++) {
+        if (!server->players[i])
+            continue;
+        event_fill_player(&event, server->players[i]);
+        event.type = EVENT_PNW;
+        journal_write_event(journal, &event, server->players[i]->team,
+            server->tick);
+        event.type = EVENT_PIN;
+        journal_write_event(journal, &event, NULL, server->tick);
+    }
+}
+
+/*
+** A marker, then pnw + pin for every player and bct for every tile, so
+** a reader can rebuild the world from the closest keyframe.
+*/
+static void write_keyframe(server_t *server, journal_t *journal)
+{
+    journal_record_t marker = {sizeof(marker), JOURNAL_KEYFRAME, 0,
+        server->tick, 0, 0, 0, 0};
+    event_t event = {.type = EVENT_BCT};
+
+    journal_append(journal, &marker, sizeof(marker));
+    write_players(server, journal);
+    for (int y = 0; y < server->map->height; y++)
+        for (int x = 0; x < server->map->width; x++) {
+            event_fill_tile(&event, server->map, x, y);
+            journal_write_event(journal, &event, NULL, server->tick);
+        }
+}
+
+/*
+** One record per tick: the digest is split over id (low half) and
+** value (high half).
+*/
+static void write_digest(server_t *server, journal_t *journal)
+{
+    uint64_t digest = server->sync.digest;
+    journal_record_t record = {sizeof(record), JOURNAL_DIGEST, 0,
+        server->tick, (int32_t)(uint32_t)digest, 0, 0,
+        (int32_t)(uint32_t)(digest >> 32)};
+
+    journal_append(journal, &record, sizeof(record));
+}
+
+/*
+** Runs after each bus flush, so the records of a tick come after its
+** events, and keyframes keep their cadence on ticks without events.
+*/
+void journal_tick(server_t *server)
+{
+    journal_t *journal = server->journal;
+    size_t used = 0;
+
+    if (!journal)
+        return;
+    used = atomic_load(&journal->head) - atomic_load(&journal->tail);
+    if (server->tick >= journal->next_keyframe &&
+        journal->ring_size - used >= journal_keyframe_size(server)) {
+        write_keyframe(server, journal);
+        journal->next_keyframe = server->tick + JOURNAL_KEYFRAME_TICKS;
+    }
+    if (journal->digest_tick == server->tick)
+        return;
+    journal->digest_tick = server->tick;
+    write_digest(server, journal);
+}
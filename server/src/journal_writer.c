@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** journal writer thread: ring to mapped file, tick index
+*/
+
+#define _GNU_SOURCE
+#include "journal.h"
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+static bool grow(journal_t *journal, size_t needed)
+{
+    size_t size = journal->mapped;
+    char *map = NULL;
+
+    while (size < needed)
+        size += JOURNAL_CHUNK;
+    if (size == journal->mapped)
+        return true;
+    if (ftruncate(journal->fd, size) < 0)
+        return false;
+    map = mremap(journal->map, journal->mapped, size, MREMAP_MAYMOVE);
+    if (map == MAP_FAILED)
+        return false;
+    journal->map = map;
+    journal->mapped = size;
+    return true;
+}
+
+/*
+** The index is flushed with every keyframe so a reader can seek into a
+** journal that is still being written.
+*/
+static void index_records(journal_t *journal)
+{
+    journal_record_t *record = NULL;
+    journal_index_t entry;
+
+    while (journal->scanned + sizeof(journal_record_t) <= journal->length) {
+        record = (journal_record_t *)(journal->map + journal->scanned);
+        if (record->type == JOURNAL_KEYFRAME ||
+            record->tick >= journal->next_index) {
+            entry = (journal_index_t){record->tick, record->type ==
+                JOURNAL_KEYFRAME ? JOURNAL_INDEX_KEYFRAME : 0,
+                journal->scanned};
+            fwrite(&entry, sizeof(entry), 1, journal->index);
+            if (record->type == JOURNAL_KEYFRAME)
+                fflush(journal->index);
+            journal->next_index = (record->tick / JOURNAL_INDEX_TICKS + 1) *
+                JOURNAL_INDEX_TICKS;
+        }
+        journal->scanned += record->size;
+    }
+}
+
+static size_t drain(journal_t *journal)
+{
+    size_t head = atomic_load_explicit(&journal->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&journal->tail, memory_order_relaxed);
+    size_t count = head - tail;
+    size_t at = tail & (journal->ring_size - 1);
+    size_t first = count < journal->ring_size - at ? count :
+        journal->ring_size - at;
+
+    if (!count || !grow(journal, journal->length + count))
+        return 0;
+    memcpy(journal->map + journal->length, journal->ring + at, first);
+    memcpy(journal->map + journal->length + first, journal->ring,
+        count - first);
+    journal->length += count;
+    atomic_store_explicit(&journal->tail, head, memory_order_release);
+    index_records(journal);
+    return count;
+}
+
+void *journal_writer(void *arg)
+{
+    journal_t *journal = arg;
+
+    while (atomic_load(&journal->running)) {
+        if (!drain(journal))
+            usleep(1000);
+    }
+    while (drain(journal));
+    fflush(journal->index);
+    return NULL;
+}
@@ -0,0 +1,86 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** logger lifetime and background drain thread
+*/
+
+#include "log.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static struct {
+    atomic_int level;
+    atomic_bool running;
+    bool started;
+    FILE *out;
+    pthread_t thread;
+} logger = {LOG_OFF, false, false, NULL, 0};
+
+static bool drain_ring(void)
+{
+    char line[LOG_LINE_SIZE];
+    log_record_t *record = log_ring_peek();
+    bool drained = false;
+
+    while (record) {
+        fwrite(line, 1, log_render(record, line, sizeof(line)), logger.out);
+        log_ring_release(record);
+        drained = true;
+        record = log_ring_peek();
+    }
+    if (drained)
+        fflush(logger.out);
+    return drained;
+}
+
+static void *drain_loop(void *arg)
+{
+    struct timespec pause = {0, 2000000};
+
+    (void)arg;
+    while (atomic_load(&logger.running)) {
+        if (!drain_ring())
+            nanosleep(&pause, NULL);
+    }
+    drain_ring();
+    return NULL;
+}
+
+int log_init(log_level_t level, const char *path)
+{
+    logger.out = path ? fopen(path, "a") : stdout;
+    if (!logger.out) {
+        perror("fopen");
+        return -1;
+    }
+    log_ring_init();
+    atomic_store(&logger.running, true);
+    if (pthread_create(&logger.thread, NULL, &drain_loop, NULL) != 0) {
+        atomic_store(&logger.running, false);
+        return -1;
+    }
+    logger.started = true;
+    atomic_store(&logger.level, level);
+    return 0;
+}
+
+void log_shutdown(void)
+{
+    if (!logger.started)
+        return;
+    atomic_store(&logger.level, LOG_OFF);
+    atomic_store(&logger.running, false);
+    pthread_join(logger.thread, NULL);
+    if (logger.out != stdout)
+        fclose(logger.out);
+    logger.started = false;
+}
+
+bool log_enabled(log_level_t level)
+{
+    return (int)level >= atomic_load_explicit(&logger.level,
+        memory_order_relaxed) && (int)level >= log_floor;
+}
@@ -0,0 +1,86 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** render binary log records back to text on the drain thread
+*/
+
+#include "log.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static void build_format(const char *spec, const char *conv, char *format,
+    size_t size)
+{
+    size_t len = 1;
+
+    format[0] = '%';
+    for (; spec < conv && len < size - 4; spec++)
+        if (!strchr("hlzjt", *spec))
+            format[len++] = *spec;
+    if (strchr("diuxXo", *conv)) {
+        memcpy(format + len, "ll", 2);
+        len += 2;
+    }
+    format[len] = *conv;
+    format[len + 1] = '\0';
+}
+
+static int render_arg(const log_record_t *record, const log_arg_t *arg,
+    const char *spec, char *out, size_t size)
+{
+    const char *conv = log_skip_spec(spec);
+    char format[32];
+
+    build_format(spec, conv, format, sizeof(format));
+    if (*conv == 'c')
+        return snprintf(out, size, format, (int)arg->i);
+    if (strchr("di", *conv))
+        return snprintf(out, size, format, arg->i);
+    if (strchr("uxXo", *conv))
+        return snprintf(out, size, format, arg->u);
+    if (strchr("fFeEgG", *conv))
+        return snprintf(out, size, format, arg->f);
+    if (*conv == 's')
+        return snprintf(out, size, format, record->text + arg->offset);
+    return *conv == 'p' ? snprintf(out, size, format, arg->p) : 0;
+}
+
+static size_t render_prefix(const log_record_t *record, char *out,
+    size_t size)
+{
+    time_t secs = record->time_ns / 1000000000ULL;
+    struct tm tm;
+    size_t len = 0;
+
+    localtime_r(&secs, &tm);
+    len = strftime(out, size, "[%H:%M:%S", &tm);
+    len += snprintf(out + len, size - len, ".%03llu] %-5s ",
+        (unsigned long long)(record->time_ns / 1000000 % 1000),
+        log_level_name(record->level));
+    return len;
+}
+
+size_t log_render(const log_record_t *record, char *out, size_t size)
+{
+    size_t len = render_prefix(record, out, size);
+    int n = 0;
+
+    for (const char *p = record->fmt; *p && len < size - 2; p++) {
+        if (*p != '%' || *log_skip_spec(p + 1) == '%' ||
+            !*log_skip_spec(p + 1)) {
+            out[len++] = *p;
+            p += *p == '%' && *log_skip_spec(p + 1) == '%';
+            continue;
+        }
+        len += render_arg(record, &record->args[n < LOG_MAX_ARGS ? n : 0],
+            p + 1, out + len, size - 1 - len);
+        len = len < size - 2 ? len : size - 2;
+        p = log_skip_spec(p + 1);
+        n++;
+    }
+    for (; len > 0 && out[len - 1] == '\n'; len--);
+    out[len++] = '\n';
+    return len;
+}
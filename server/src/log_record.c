@@ -0,0 +1,91 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** marshal printf-style arguments into binary log records
+*/
+
+#include "log.h"
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+
+static atomic_size_t dropped;
+
+static void store_string(log_record_t *record, log_arg_t *arg,
+    const char *str, size_t *used)
+{
+    size_t room = LOG_TEXT_SIZE - 1 - *used;
+    size_t len = 0;
+
+    if (!str)
+        str = "(null)";
+    len = strnlen(str, room);
+    memcpy(record->text + *used, str, len);
+    record->text[*used + len] = '\0';
+    arg->offset = *used;
+    *used += len + (*used + len < LOG_TEXT_SIZE - 1);
+}
+
+static void store_arg(log_record_t *record, log_arg_t *arg,
+    const char *spec, va_list *ap, size_t *used)
+{
+    const char *conv = log_skip_spec(spec);
+    int longs = log_count_long(spec, conv);
+
+    if (strchr("di", *conv))
+        arg->i = longs >= 2 ? va_arg(*ap, long long) :
+            (longs ? va_arg(*ap, long) : va_arg(*ap, int));
+    if (strchr("uxXo", *conv))
+        arg->u = longs >= 2 ? va_arg(*ap, unsigned long long) :
+            (longs ? va_arg(*ap, unsigned long) : va_arg(*ap, unsigned));
+    if (*conv == 'c')
+        arg->i = va_arg(*ap, int);
+    if (strchr("fFeEgG", *conv))
+        arg->f = va_arg(*ap, double);
+    if (*conv == 'p')
+        arg->p = va_arg(*ap, void *);
+    if (*conv == 's')
+        store_string(record, arg, va_arg(*ap, const char *), used);
+}
+
+static void marshal_args(log_record_t *record, const char *fmt, va_list *ap)
+{
+    const char *conv = fmt;
+    size_t used = 0;
+    int n = 0;
+
+    for (const char *p = strchr(fmt, '%'); p && n < LOG_MAX_ARGS;
+        p = strchr(conv + 1, '%')) {
+        conv = log_skip_spec(p + 1);
+        if (*conv == '\0')
+            return;
+        if (*conv != '%')
+            store_arg(record, &record->args[n++], p + 1, ap, &used);
+    }
+}
+
+void log_write(log_level_t level, const char *fmt, ...)
+{
+    log_record_t *record = log_ring_claim();
+    struct timespec now;
+    va_list ap;
+
+    if (!record) {
+        atomic_fetch_add_explicit(&dropped, 1, memory_order_relaxed);
+        return;
+    }
+    clock_gettime(CLOCK_REALTIME, &now);
+    record->time_ns = now.tv_sec * 1000000000ULL + now.tv_nsec;
+    record->fmt = fmt;
+    record->level = level;
+    va_start(ap, fmt);
+    marshal_args(record, fmt, &ap);
+    va_end(ap);
+    log_ring_commit(record);
+}
+
+size_t log_dropped(void)
+{
+    return atomic_load_explicit(&dropped, memory_order_relaxed);
+}
@@ -0,0 +1,62 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** bounded lock-free multi-producer ring of log records
+*/
+
+#include "log.h"
+
+static log_record_t ring[LOG_RING_SIZE];
+static atomic_size_t head;
+static size_t tail;
+
+void log_ring_init(void)
+{
+    for (size_t i = 0; i < LOG_RING_SIZE; i++)
+        atomic_init(&ring[i].seq, i);
+    atomic_init(&head, 0);
+    tail = 0;
+}
+
+log_record_t *log_ring_claim(void)
+{
+    size_t pos = atomic_load_explicit(&head, memory_order_relaxed);
+    log_record_t *record = NULL;
+    size_t seq = 0;
+
+    while (1) {
+        record = &ring[pos % LOG_RING_SIZE];
+        seq = atomic_load_explicit(&record->seq, memory_order_acquire);
+        if (seq < pos)
+            return NULL;
+        if (seq == pos && atomic_compare_exchange_weak_explicit(&head, &pos,
+            pos + 1, memory_order_relaxed, memory_order_relaxed))
+            return record;
+        if (seq > pos)
+            pos = atomic_load_explicit(&head, memory_order_relaxed);
+    }
+}
+
+void log_ring_commit(log_record_t *record)
+{
+    size_t seq = atomic_load_explicit(&record->seq, memory_order_relaxed);
+
+    atomic_store_explicit(&record->seq, seq + 1, memory_order_release);
+}
+
+log_record_t *log_ring_peek(void)
+{
+    log_record_t *record = &ring[tail % LOG_RING_SIZE];
+
+    if (atomic_load_explicit(&record->seq, memory_order_acquire) != tail + 1)
+        return NULL;
+    return record;
+}
+
+void log_ring_release(log_record_t *record)
+{
+    atomic_store_explicit(&record->seq, tail + LOG_RING_SIZE,
+        memory_order_release);
+    tail++;
+}
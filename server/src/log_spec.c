@@ -0,0 +1,60 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** log format specifiers, level names and the shedding floor
+*/
+
+#include "log.h"
+#include <string.h>
+#include <strings.h>
+
+static const char *level_names[] = {"trace", "debug", "info", "warn",
+    "error", "off"};
+
+/*
+** Per thread: the floor belongs to the world the thread is running, and
+** zappy_host runs many worlds on a handful of threads.
+*/
+__thread int log_floor = LOG_TRACE;
+
+void log_set_floor(log_level_t level)
+{
+    log_floor = level;
+}
+
+const char *log_skip_spec(const char *spec)
+{
+    while (*spec && strchr("-+ #0123456789.hlzjt", *spec))
+        spec++;
+    return spec;
+}
+
+int log_count_long(const char *spec, const char *conv)
+{
+    int longs = 0;
+
+    for (; spec < conv; spec++) {
+        if (*spec == 'l')
+            longs++;
+        if (*spec == 'z' || *spec == 'j' || *spec == 't')
+            longs += 2;
+    }
+    return longs;
+}
+
+const char *log_level_name(int level)
+{
+    if (level < LOG_TRACE || level > LOG_OFF)
+        return "?";
+    return level_names[level];
+}
+
+int log_parse_level(const char *name)
+{
+    for (int i = LOG_TRACE; i <= LOG_OFF; i++) {
+        if (name && strcasecmp(name, level_names[i]) == 0)
+            return i;
+    }
+    return -1;
+}
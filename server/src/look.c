@@ -39,7 +39,7 @@ bool process_vision_level(process_context_t *ctx, int level)
 char *build_look_response(server_t *server, player_t *player)
 {
     size_t response_size = calculate_response_size(server, player);
-    char *response = malloc(response_size);
+    char *response = mem_alloc(MEM_RESPONSES, response_size);
     bool first_item = true;
     int vision_range = player->lvl;
     response_context_t resp_ctx = {response, &first_item};
@@ -50,7 +50,7 @@ char *build_look_response(server_t *server, player_t *player)
     strcpy(response, "[");
     for (int level = 0; level <= vision_range; level++) {
         if (!process_vision_level(&proc_ctx, level)) {
-            free(response);
+            mem_free(MEM_RESPONSES, response);
             return NULL;
         }
     }
@@ -60,12 +60,18 @@ char *build_look_response(server_t *server, player_t *player)
 
 void cmd_look(server_t *server, player_t *player)
 {
+    PROF_FUNC();
     char *response = build_look_response(server, player);
 
     if (!response) {
-        dprintf(player->fd, "ko\n");
+        player_reply(server, player, "ko\n");
         return;
     }
-    dprintf(player->fd, "%s\n", response);
-    free(response);
+    player_reply(server, player, "%s\n", response);
+    mem_free(MEM_RESPONSES, response);
+}
+
+void cmd_idle(server_t *server, player_t *player)
+{
+    player_reply(server, player, "ok\n");
 }
@@ -14,52 +14,77 @@
 #include <netinet/in.h>
 #include <fcntl.h>
 #include <sys/time.h>
+#include <signal.h>
 
-static void process_client_messages(server_t *server, server_config_t *config)
+static volatile sig_atomic_t stop_requested = 0;
+
+static void request_stop(int sig)
 {
+    (void)sig;
+    stop_requested = 1;
+}
+
+static uint64_t process_io(server_t *server, server_config_t *config)
+{
+    PROF_FUNC();
+    uint64_t start_ns = metrics_now_ns();
+
+    process_new_connections(server);
     for (int i = 1; i < NB_CONNECTION + 1; i++) {
         if (server->pfds[i].fd != FD_NULL)
             read_client(server, config, i);
     }
+    remove_disconnected_clients(server);
+    admin_service(server);
+    return budget_charge(server, BUDGET_IO, start_ns);
 }
 
-static void display_server_info(server_config_t *config)
+/*
+** One pass of the loop once poll() has filled revents: inputs, then the
+** tick if it is due, then publication.
+*/
+void server_step(server_t *server, server_config_t *config,
+    struct timeval *last_tick, int *tick_count)
 {
-    printf("Server launched: port=%d, freq=%d, teams=%d\n",
-        config->port, config->freq, config->team_nb);
-    for (int i = 0; i < config->team_nb; i++) {
-        printf("Team %d: %s (max_players=%d)\n",
-            i, config->teams[i].name, config->teams[i].max_players);
-    }
+    uint64_t start_ns = process_io(server, config);
+
+    handle_game_tick(server, config, last_tick, tick_count);
+    event_bus_flush(&server->events);
+    journal_tick(server);
+    start_ns = budget_charge(server, BUDGET_SIM, start_ns);
+    shm_world_publish(server);
+    budget_charge(server, BUDGET_PUBLISH, start_ns);
 }
 
 static void server_main_loop(server_t *server, server_config_t *config)
 {
     int clients_connected;
     struct timeval last_tick;
-    int tick_count = 0;
-    int timeout = 0;
+    int tick_count = server->tick % RESPAWN_TICKS;
 
     gettimeofday(&last_tick, NULL);
-    while (1) {
-        timeout = 1000 / config->freq;
-        clients_connected = wait_activity(server, timeout);
+    while (!stop_requested) {
+        clients_connected = wait_activity(server, 1000 / config->freq);
         if (clients_connected < 0) {
-                perror("Erreur poll");
+            if (errno != EINTR)
+                log_error("poll failed: errno %d", errno);
             continue;
         }
-        process_new_connections(server);
-        process_client_messages(server, config);
-        remove_disconnected_clients(server);
-        handle_game_tick(server, config, &last_tick, &tick_count);
+        server_step(server, config, &last_tick, &tick_count);
     }
 }
 
 int launch_server(server_t *server, server_config_t *config)
 {
+    struct sigaction action = {0};
+
+    action.sa_handler = &request_stop;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
     server->config = config;
     reset_server_clients(server);
     display_server_info(config);
     server_main_loop(server, config);
+    log_info("Server stopping");
     return SUCCESS;
 }
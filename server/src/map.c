@@ -5,8 +5,9 @@
 ** map
 */
 #include "map.h"
+#include "prof.h"
+#include "mem.h"
 #include <stdlib.h>
-#include <time.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -36,38 +37,58 @@ void init_map(map_t *map, int width, int height)
 {
     map->width = width;
     map->height = height;
-    map->tiles = malloc(sizeof(tile_t *) * height);
+    map->tiles = mem_alloc(MEM_MAP, sizeof(tile_t *) * height);
     if (!map->tiles) {
         return;
     }
     for (int y = 0; y < height; y++) {
-        map->tiles[y] = calloc(width, sizeof(tile_t));
+        map->tiles[y] = mem_calloc(MEM_MAP, width, sizeof(tile_t));
     }
 }
 
-void generate_resources(map_t *map)
+static void place_resources(map_t *map, rng_t *rng, int type, int quantity)
 {
-    int quantity = 0;
+    uint32_t cells[RNG_BATCH];
+    int count = 0;
     int x = 0;
     int y = 0;
 
-    srand(time(NULL));
-    for (int type = 0; type < RESOURCE_COUNT; type++) {
-        quantity = map->width * map->height * get_resource_density(type);
-        for (int i = 0; i < quantity; i++) {
-            x = rand() % map->width;
-            y = rand() % map->height;
+    for (int done = 0; done < quantity; done += count) {
+        count = quantity - done < RNG_BATCH ? quantity - done : RNG_BATCH;
+        rng_fill_below(rng, cells, count, map->width * map->height);
+        for (int i = 0; i < count; i++) {
+            x = cells[i] % map->width;
+            y = cells[i] / map->width;
             map->tiles[y][x].resources[type]++;
             map->tiles[y][x].changed = true;
+            if (map->touch)
+                map->touch(map->touch_ctx, x, y);
         }
     }
 }
 
+void generate_resources_share(map_t *map, rng_t *rng, int part, int parts)
+{
+    PROF_FUNC();
+    int total = 0;
+
+    for (int type = 0; type < RESOURCE_COUNT; type++) {
+        total = map->width * map->height * get_resource_density(type);
+        place_resources(map, rng, type,
+            total * (part + 1) / parts - total * part / parts);
+    }
+}
+
+void generate_resources(map_t *map, rng_t *rng)
+{
+    generate_resources_share(map, rng, 0, 1);
+}
+
 void free_map(map_t *map)
 {
     for (int y = 0; y < map->height; y++) {
-        free(map->tiles[y]);
+        mem_free(MEM_MAP, map->tiles[y]);
     }
-    free(map->tiles);
-    free(map);
+    mem_free(MEM_MAP, map->tiles);
+    mem_free(MEM_MAP, map);
 }
@@ -0,0 +1,80 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** mct rows cached as encoded text, re-encoded only when a tile changed
+*/
+
+#include "gui.h"
+#include <string.h>
+#include <unistd.h>
+
+void init_mct(server_t *server)
+{
+    mct_cache_t *cache = &server->mct;
+
+    cache->rows = server->map->height;
+    cache->lines = mem_calloc(MEM_RESPONSES, cache->rows, sizeof(char *));
+    cache->lens = mem_calloc(MEM_RESPONSES, cache->rows, sizeof(size_t));
+    cache->caps = mem_calloc(MEM_RESPONSES, cache->rows, sizeof(size_t));
+    cache->dirty = mem_alloc(MEM_RESPONSES, cache->rows * sizeof(bool));
+    if (cache->dirty)
+        memset(cache->dirty, true, cache->rows * sizeof(bool));
+}
+
+void free_mct(server_t *server)
+{
+    mct_cache_t *cache = &server->mct;
+
+    for (int y = 0; cache->lines && y < cache->rows; y++)
+        mem_free(MEM_RESPONSES, cache->lines[y]);
+    mem_free(MEM_RESPONSES, cache->lines);
+    mem_free(MEM_RESPONSES, cache->lens);
+    mem_free(MEM_RESPONSES, cache->caps);
+    mem_free(MEM_RESPONSES, cache->dirty);
+    memset(cache, 0, sizeof(mct_cache_t));
+}
+
+static bool reserve_row(mct_cache_t *cache, int y, size_t needed)
+{
+    char *line = NULL;
+
+    if (cache->caps[y] >= needed)
+        return true;
+    line = mem_realloc(MEM_RESPONSES, cache->lines[y], needed);
+    if (!line)
+        return false;
+    cache->lines[y] = line;
+    cache->caps[y] = needed;
+    return true;
+}
+
+static bool encode_row(server_t *server, int y)
+{
+    mct_cache_t *cache = &server->mct;
+    char line[GUI_LINE_SIZE];
+    size_t len = 0;
+    int n = 0;
+
+    for (int x = 0; x < server->map->width; x++) {
+        n = format_bct(line, server->map, x, y);
+        if (!reserve_row(cache, y, (len + n) * 2))
+            return false;
+        memcpy(cache->lines[y] + len, line, n);
+        len += n;
+    }
+    cache->lens[y] = len;
+    cache->dirty[y] = false;
+    return true;
+}
+
+void send_mct(server_t *server, int fd)
+{
+    mct_cache_t *cache = &server->mct;
+
+    for (int y = 0; y < cache->rows; y++) {
+        if (cache->dirty[y] && !encode_row(server, y))
+            continue;
+        write(fd, cache->lines[y], cache->lens[y]);
+    }
+}
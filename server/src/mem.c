@@ -0,0 +1,62 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** tagged allocation wrappers
+*/
+
+#include "mem.h"
+#include "mem_stats.h"
+#include <malloc.h>
+#include <stdlib.h>
+
+mem_stats_t mem_stats[MEM_TAGS];
+
+static void account(mem_tag_t tag, size_t size)
+{
+    mem_stats_t *stats = &mem_stats[tag];
+    uint64_t live = atomic_fetch_add_explicit(&stats->live, size,
+        memory_order_relaxed) + size;
+    uint64_t peak = atomic_load_explicit(&stats->peak, memory_order_relaxed);
+
+    atomic_fetch_add_explicit(&stats->allocs, 1, memory_order_relaxed);
+    while (live > peak && !atomic_compare_exchange_weak_explicit(&stats->peak,
+        &peak, live, memory_order_relaxed, memory_order_relaxed));
+}
+
+static void unaccount(mem_tag_t tag, size_t size)
+{
+    atomic_fetch_sub_explicit(&mem_stats[tag].live, size,
+        memory_order_relaxed);
+    atomic_fetch_add_explicit(&mem_stats[tag].frees, 1, memory_order_relaxed);
+}
+
+void *mem_alloc(mem_tag_t tag, size_t size)
+{
+    void *ptr = malloc(size);
+
+    if (ptr)
+        account(tag, malloc_usable_size(ptr));
+    return ptr;
+}
+
+void *mem_realloc(mem_tag_t tag, void *ptr, size_t size)
+{
+    size_t old = ptr ? malloc_usable_size(ptr) : 0;
+    void *grown = realloc(ptr, size);
+
+    if (!grown)
+        return NULL;
+    if (ptr)
+        unaccount(tag, old);
+    account(tag, malloc_usable_size(grown));
+    return grown;
+}
+
+void mem_free(mem_tag_t tag, void *ptr)
+{
+    if (!ptr)
+        return;
+    unaccount(tag, malloc_usable_size(ptr));
+    free(ptr);
+}
@@ -0,0 +1,74 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** calloc / strdup on top of mem_alloc, and the counters export
+*/
+
+#include "mem_stats.h"
+#include "log.h"
+#include <string.h>
+#include <stdlib.h>
+
+static const char *tag_names[MEM_TAGS] = {
+    "map", "players", "actions", "network", "responses", "gui", "events"
+};
+
+void *mem_calloc(mem_tag_t tag, size_t count, size_t size)
+{
+    void *ptr = NULL;
+
+    if (size && count > SIZE_MAX / size)
+        return NULL;
+    ptr = mem_alloc(tag, count * size);
+    if (ptr)
+        memset(ptr, 0, count * size);
+    return ptr;
+}
+
+char *mem_strdup(mem_tag_t tag, const char *str)
+{
+    size_t len = strlen(str) + 1;
+    char *copy = mem_alloc(tag, len);
+
+    if (copy)
+        memcpy(copy, str, len);
+    return copy;
+}
+
+static void write_family(FILE *out, const char *name, const char *type,
+    size_t offset)
+{
+    const _Atomic uint64_t *value = NULL;
+
+    fprintf(out, "# TYPE %s %s\n", name, type);
+    for (int i = 0; i < MEM_TAGS; i++) {
+        value = (const _Atomic uint64_t *)((const char *)&mem_stats[i] +
+            offset);
+        fprintf(out, "%s{subsystem=\"%s\"} %llu\n", name, tag_names[i],
+            (unsigned long long)atomic_load_explicit(value,
+            memory_order_relaxed));
+    }
+}
+
+void mem_write_prometheus(FILE *out)
+{
+    write_family(out, "zappy_memory_live_bytes", "gauge",
+        offsetof(mem_stats_t, live));
+    write_family(out, "zappy_memory_peak_bytes", "gauge",
+        offsetof(mem_stats_t, peak));
+    write_family(out, "zappy_memory_allocations_total", "counter",
+        offsetof(mem_stats_t, allocs));
+    write_family(out, "zappy_memory_frees_total", "counter",
+        offsetof(mem_stats_t, frees));
+}
+
+void mem_report(void)
+{
+    for (int i = 0; i < MEM_TAGS; i++)
+        log_info("memory %s: live=%lu peak=%lu allocs=%lu frees=%lu",
+            tag_names[i], (unsigned long)mem_stats[i].live,
+            (unsigned long)mem_stats[i].peak,
+            (unsigned long)mem_stats[i].allocs,
+            (unsigned long)mem_stats[i].frees);
+}
@@ -0,0 +1,68 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** metrics recorded on the simulation thread
+*/
+
+#include "server.h"
+#include <string.h>
+#include <time.h>
+
+static const char *command_names[METRICS_COMMANDS] = {
+    "Forward", "Right", "Left", "Look", "Inventory", "Broadcast",
+    "Connect_nbr", "Fork", "Eject", "Take", "Set", "Incantation", "Idle",
+    "unknown"
+};
+
+uint64_t metrics_now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+const char *metrics_command_name(int index)
+{
+    return command_names[index];
+}
+
+void metrics_command(server_t *server, const char *name)
+{
+    int i = 0;
+
+    while (i < METRICS_COMMANDS - 1 && strcmp(name, command_names[i]) != 0)
+        i++;
+    server->metrics.live.commands[i]++;
+}
+
+void metrics_events(void *ctx, const event_t *events, size_t count,
+    const char *text)
+{
+    metrics_t *live = &((server_t *)ctx)->metrics.live;
+
+    (void)text;
+    for (size_t i = 0; i < count; i++)
+        live->events[events[i].type]++;
+}
+
+void metrics_tick(server_t *server, uint64_t start_ns, long late_usec)
+{
+    metrics_t *live = &server->metrics.live;
+    int depth = 0;
+
+    live->ticks++;
+    live->players = 0;
+    hist_record(&live->tick_ns, metrics_now_ns() - start_ns);
+    hist_record(&live->tick_late_ns, late_usec > 0 ? late_usec * 1000 : 0);
+    for (int i = 0; i < server->player_nb; i++) {
+        if (!server->players[i])
+            continue;
+        depth = 0;
+        for (action_t *a = server->players[i]->action_queue; a; a = a->next)
+            depth++;
+        hist_record(&live->queue_depth, depth);
+        live->players++;
+    }
+}
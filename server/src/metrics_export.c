@@ -0,0 +1,94 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** Prometheus text rendering of a metrics snapshot
+*/
+
+#include "metrics.h"
+#include <stdio.h>
+
+static const double time_bounds[] = {1e-5, 5e-5, 1e-4, 5e-4, 1e-3, 5e-3,
+    1e-2, 5e-2, 1e-1, 5e-1, 1, -1};
+static const double depth_bounds[] = {0, 1, 2, 4, 8, 10, 16, -1};
+static const double quantiles[] = {0.5, 0.9, 0.99, 0.999, -1};
+
+static void write_hist(FILE *out, const char *name, const hist_t *hist,
+    double scale)
+{
+    const double *bounds = scale < 1 ? time_bounds : depth_bounds;
+
+    fprintf(out, "# TYPE %s histogram\n", name);
+    for (int i = 0; bounds[i] >= 0; i++)
+        fprintf(out, "%s_bucket{le=\"%g\"} %llu\n", name, bounds[i],
+            (unsigned long long)hist_count_below(hist, bounds[i] / scale));
+    fprintf(out, "%s_bucket{le=\"+Inf\"} %llu\n%s_sum %g\n%s_count %llu\n",
+        name, (unsigned long long)hist->total, name, hist->sum * scale,
+        name, (unsigned long long)hist->total);
+    fprintf(out, "# TYPE %s_quantile gauge\n", name);
+    for (int i = 0; quantiles[i] >= 0; i++)
+        fprintf(out, "%s_quantile{quantile=\"%g\"} %g\n", name, quantiles[i],
+            hist_quantile(hist, quantiles[i]) * scale);
+}
+
+static void write_counter(FILE *out, const char *name, uint64_t value)
+{
+    fprintf(out, "# TYPE %s counter\n%s %llu\n", name, name,
+        (unsigned long long)value);
+}
+
+static void write_clients(FILE *out, const metrics_t *metrics)
+{
+    static const char *types[] = {"unidentified", "ai", "gui"};
+
+    fprintf(out, "# TYPE zappy_players gauge\nzappy_players %d\n",
+        metrics->players);
+    fprintf(out, "# TYPE zappy_client_backlog_bytes gauge\n");
+    for (int i = 1; i < METRICS_SLOTS; i++) {
+        if (metrics->backlog[i] < 0)
+            continue;
+        fprintf(out, "zappy_client_backlog_bytes{slot=\"%d\",type=\"%s\"}"
+            " %lld\n", i, types[(metrics->slot_type[i] + 1) % 3],
+            (long long)metrics->backlog[i]);
+    }
+}
+
+static void write_budget(FILE *out, const budget_stats_t *shed)
+{
+    static const char *phases[] = {"io", "sim", "publish"};
+
+    fprintf(out, "# TYPE zappy_shed_level gauge\nzappy_shed_level %d\n"
+        "# TYPE zappy_tick_load_ratio gauge\nzappy_tick_load_ratio %g\n"
+        "# TYPE zappy_tick_phase_seconds gauge\n", shed->level,
+        shed->load_permille / 1000.0);
+    for (int i = 0; i < BUDGET_PHASES; i++)
+        fprintf(out, "zappy_tick_phase_seconds{phase=\"%s\"} %g\n",
+            phases[i], shed->phase_ns[i] * 1e-9);
+    fprintf(out, "# TYPE zappy_shed_ticks_total counter\n");
+    for (int i = 0; i < SHED_LEVELS; i++)
+        fprintf(out, "zappy_shed_ticks_total{level=\"%d\"} %llu\n", i,
+            (unsigned long long)shed->level_ticks[i]);
+    write_counter(out, "zappy_shed_transitions_total", shed->transitions);
+    write_counter(out, "zappy_shed_deferred_total", shed->deferred_tiles);
+    write_counter(out, "zappy_shed_spread_ticks_total", shed->spread_ticks);
+}
+
+void metrics_write_prometheus(FILE *out, const metrics_t *metrics)
+{
+    metrics_write_counts(out, metrics);
+    write_counter(out, "zappy_gui_commands_total", metrics->gui_commands);
+    write_counter(out, "zappy_ticks_total", metrics->ticks);
+    write_counter(out, "zappy_bytes_in_total", metrics->bytes_in);
+    write_counter(out, "zappy_bytes_out_total", metrics->bytes_out);
+    write_counter(out, "zappy_gui_lines_total", metrics->gui_lines);
+    write_counter(out, "zappy_gui_bytes_total", metrics->gui_bytes);
+    write_clients(out, metrics);
+    write_hist(out, "zappy_tick_duration_seconds", &metrics->tick_ns, 1e-9);
+    write_hist(out, "zappy_tick_lateness_seconds", &metrics->tick_late_ns,
+        1e-9);
+    write_hist(out, "zappy_gui_fanout_seconds", &metrics->gui_fanout_ns,
+        1e-9);
+    write_hist(out, "zappy_action_queue_depth", &metrics->queue_depth, 1);
+    metrics_write_latency(out, metrics);
+    write_budget(out, &metrics->shed);
+}
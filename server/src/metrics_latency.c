@@ -0,0 +1,67 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** per-command latency from socket read to reply flush
+*/
+
+#include "server.h"
+#include <string.h>
+
+static int command_index(const char *name)
+{
+    int i = 0;
+
+    while (i < METRICS_COMMANDS - 1 &&
+        strcmp(name, metrics_command_name(i)) != 0)
+        i++;
+    return i;
+}
+
+void metrics_latency(server_t *server, const char *name, uint64_t read_ns,
+    uint64_t expected_ns)
+{
+    uint64_t now = metrics_now_ns();
+    int i = command_index(name);
+    uint64_t latency = 0;
+
+    if (!read_ns || now < read_ns)
+        return;
+    latency = now - read_ns;
+    hist_record(&server->metrics.live.cmd_latency_ns[i], latency);
+    hist_record(&server->metrics.live.cmd_overhead_ns[i],
+        latency > expected_ns ? latency - expected_ns : 0);
+}
+
+/*
+** The countdown of an action only starts once it reaches the head of
+** the queue, so the wait behind earlier actions is not overhead either.
+*/
+void metrics_action_done(server_t *server, const char *name,
+    const action_t *action)
+{
+    uint64_t scheduled = (uint64_t)action->ticks *
+        server->config->tick_freq * 1000;
+    uint64_t waited = action->start_ns - action->enqueue_ns;
+
+    metrics_latency(server, name, action->read_ns, scheduled + waited);
+}
+
+void metrics_report(server_t *server)
+{
+    const metrics_t *live = &server->metrics.live;
+    const hist_t *lat = NULL;
+    const hist_t *over = NULL;
+
+    for (int i = 0; i < METRICS_COMMANDS; i++) {
+        lat = &live->cmd_latency_ns[i];
+        over = &live->cmd_overhead_ns[i];
+        if (!lat->total)
+            continue;
+        log_info("%s: n=%lu latency p50=%.3fms p99=%.3fms max=%.3fms "
+            "overhead p50=%.3fms p99=%.3fms", metrics_command_name(i),
+            (unsigned long)lat->total, hist_quantile(lat, 0.5) / 1e6,
+            hist_quantile(lat, 0.99) / 1e6, lat->max / 1e6,
+            hist_quantile(over, 0.5) / 1e6, hist_quantile(over, 0.99) / 1e6);
+    }
+}
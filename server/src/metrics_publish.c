@@ -0,0 +1,68 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** socket sampling and non-blocking snapshot publication
+*/
+
+#include "server.h"
+#include <string.h>
+#include <sys/ioctl.h>
+#include <linux/sockios.h>
+#include <linux/tcp.h>
+
+static void sample_socket(server_t *server, int i)
+{
+    metrics_registry_t *registry = &server->metrics;
+    struct tcp_info info;
+    socklen_t len = sizeof(info);
+    int queued = 0;
+
+    registry->live.slot_type[i] = server->clients[i].type;
+    if (getsockopt(server->pfds[i].fd, IPPROTO_TCP, TCP_INFO, &info,
+        &len) == 0 && info.tcpi_bytes_acked >= registry->acked[i]) {
+        registry->live.bytes_out += info.tcpi_bytes_acked -
+            registry->acked[i];
+        registry->acked[i] = info.tcpi_bytes_acked;
+    }
+    if (ioctl(server->pfds[i].fd, SIOCOUTQ, &queued) == 0)
+        registry->live.backlog[i] = queued;
+}
+
+void metrics_client_closed(server_t *server, int i)
+{
+    if (i <= 0 || i >= METRICS_SLOTS || server->pfds[i].fd == FD_NULL)
+        return;
+    sample_socket(server, i);
+    server->metrics.acked[i] = 0;
+    server->metrics.live.backlog[i] = -1;
+}
+
+void metrics_publish(server_t *server)
+{
+    metrics_registry_t *registry = &server->metrics;
+    uint64_t now = metrics_now_ns();
+
+    if (now - registry->published_ns < METRICS_PUBLISH_NS)
+        return;
+    registry->published_ns = now;
+    for (int i = 1; i < METRICS_SLOTS; i++) {
+        if (server->pfds[i].fd != FD_NULL)
+            sample_socket(server, i);
+        else
+            registry->live.backlog[i] = -1;
+    }
+    if (pthread_mutex_trylock(&registry->lock) != 0)
+        return;
+    memcpy(&registry->snapshot, &registry->live, sizeof(metrics_t));
+    pthread_mutex_unlock(&registry->lock);
+}
+
+void metrics_init(server_t *server)
+{
+    pthread_mutex_init(&server->metrics.lock, NULL);
+    for (int i = 0; i < METRICS_SLOTS; i++) {
+        server->metrics.live.backlog[i] = -1;
+        server->metrics.snapshot.backlog[i] = -1;
+    }
+}
@@ -0,0 +1,51 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** per-command and per-event counters, and latency summaries
+*/
+
+#include "metrics.h"
+#include <stdio.h>
+
+static const double quantiles[] = {0.5, 0.9, 0.99, 0.999, -1};
+
+static void write_summary(FILE *out, const char *name, const hist_t *hists)
+{
+    const char *command = NULL;
+
+    fprintf(out, "# TYPE %s summary\n", name);
+    for (int i = 0; i < METRICS_COMMANDS; i++) {
+        if (!hists[i].total)
+            continue;
+        command = metrics_command_name(i);
+        for (int q = 0; quantiles[q] >= 0; q++)
+            fprintf(out, "%s{command=\"%s\",quantile=\"%g\"} %g\n", name,
+                command, quantiles[q],
+                hist_quantile(&hists[i], quantiles[q]) * 1e-9);
+        fprintf(out, "%s_sum{command=\"%s\"} %g\n%s_count{command=\"%s\"}"
+            " %llu\n", name, command, hists[i].sum * 1e-9, name, command,
+            (unsigned long long)hists[i].total);
+    }
+}
+
+void metrics_write_counts(FILE *out, const metrics_t *metrics)
+{
+    fprintf(out, "# TYPE zappy_commands_total counter\n");
+    for (int i = 0; i < METRICS_COMMANDS; i++)
+        fprintf(out, "zappy_commands_total{command=\"%s\"} %llu\n",
+            metrics_command_name(i),
+            (unsigned long long)metrics->commands[i]);
+    fprintf(out, "# TYPE zappy_events_total counter\n");
+    for (int i = 0; i < EVENT_TYPES; i++)
+        fprintf(out, "zappy_events_total{type=\"%s\"} %llu\n",
+            event_name(i), (unsigned long long)metrics->events[i]);
+}
+
+void metrics_write_latency(FILE *out, const metrics_t *metrics)
+{
+    write_summary(out, "zappy_command_latency_seconds",
+        metrics->cmd_latency_ns);
+    write_summary(out, "zappy_command_overhead_seconds",
+        metrics->cmd_overhead_ns);
+}
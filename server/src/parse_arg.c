@@ -123,26 +123,84 @@ static int check_freq(server_config_t *config)
     return 0;
 }
 
-int parse_args(int ac, char **av, server_config_t *config)
+static int parse_paths(int ac, char **av, server_config_t *config, int i)
 {
-    int res = 0;
+    struct { const char *flag; char **dest; } paths[] = {
+        {"-m", &config->shm_name}, {"-L", &config->log_path},
+        {"-t", &config->prof_path}, {"-a", &config->admin_path},
+        {"-j", &config->journal_path}, {"-R", &config->record_path},
+        {"-r", &config->replay_path}, {"-k", &config->checkpoint_path},
+        {"--restore", &config->restore_path}, {NULL, NULL}
+    };
+
+    for (int j = 0; paths[j].flag; j++) {
+        if (strcmp(av[i], paths[j].flag) == 0 && i + 1 < ac) {
+            *paths[j].dest = av[i + 1];
+            i++;
+        }
+    }
+    return i;
+}
 
+static int parse_options(int ac, char **av, server_config_t *config, int i)
+{
+    i = parse_paths(ac, av, config, i);
+    if (strcmp(av[i], "-l") == 0) {
+        config->log_level = log_parse_level(i + 1 < ac ? av[i + 1] : NULL);
+        if (config->log_level < 0) {
+            printf("Error: Unknown log level\n");
+            return -1;
+        }
+        i++;
+    }
+    if (strcmp(av[i], "-w") == 0) {
+        if (i + 1 >= ac || !is_valid_int(av[i + 1]))
+            return -1;
+        config->warp = true;
+        config->warp_cap = atoi(av[i + 1]);
+        i++;
+    }
+    return i;
+}
+
+static int parse_rates(int ac, char **av, server_config_t *config, int i)
+{
+    if (strcmp(av[i], "-c") == 0) {
+        config->nb_clients = parse_world_size(i, ac, av);
+        i++;
+    }
+    if (strcmp(av[i], "-f") == 0) {
+        config->freq = parse_world_size(i, ac, av);
+        if (check_freq(config) < 0)
+            return -1;
+        i++;
+    }
+    if (strcmp(av[i], "-s") == 0) {
+        if (i + 1 >= ac || !is_valid_int(av[i + 1]))
+            return -1;
+        config->seed = strtoull(av[i + 1], NULL, 10);
+        config->seeded = true;
+        i++;
+    }
+    return i;
+}
+
+int parse_args(int ac, char **av, server_config_t *config)
+{
+    config->log_level = LOG_INFO;
+    config->argc = ac;
+    config->argv = av;
     for (int i = 1; i < ac; i++) {
         i = parse_begin(ac, av, config, i);
+        if (i != -1)
+            i = parse_rates(ac, av, config, i);
+        if (i != -1)
+            i = parse_options(ac, av, config, i);
         if (i == -1)
             return -1;
-        if (strcmp(av[i], "-c") == 0) {
-            config->nb_clients = parse_world_size(i, ac, av);
-            i++;
-        }
-        if (strcmp(av[i], "-f") == 0) {
-            config->freq = parse_world_size(i, ac, av);
-            res = check_freq(config);
-            i++;
-        }
     }
     for (int i = 1; i < ac; i++) {
         init_teams(ac, av, config, i);
     }
-    return res;
+    return 0;
 }
@@ -7,15 +7,16 @@
 
 #include "player.h"
 #include "server.h"
+#include "commands.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
 #include <unistd.h>
 
-player_t *create_player(int id, int fd, const char *team, map_t *map)
+player_t *create_player(int id, int fd, const char *team, server_t *server)
 {
-    player_t *player = malloc(sizeof(player_t));
+    player_t *player = mem_alloc(MEM_PLAYERS, sizeof(player_t));
 
     if (!player) {
         return NULL;
@@ -23,22 +24,25 @@ player_t *create_player(int id, int fd, const char *team, map_t *map)
     player->id = id;
     player->fd = fd;
     player->lvl = 1;
-    player->dir = rand() % 4;
-    player->x = rand() % map->width;
-    player->y = rand() % map->height;
+    player->dir = rng_below(&server->rng[RNG_SPAWN], 4);
+    player->x = rng_below(&server->rng[RNG_SPAWN], server->map->width);
+    player->y = rng_below(&server->rng[RNG_SPAWN], server->map->height);
     memset(player->inventory, 0, sizeof(player->inventory));
     player->inventory[FOOD] = 10;
     player->action_queue = NULL;
     player->life_remain = 1260;
     player->food_tick = 126;
-    player->team = strdup(team);
-    printf("Player: id=%d, fd=%d, team=%s, pos=(%d,%d), lvl=%d\n", player->id,
+    player->team = mem_strdup(MEM_PLAYERS, team);
+    player->hash = 0;
+    player->region = -1;
+    log_debug("Player: id=%d, fd=%d, team=%s, pos=(%d,%d), lvl=%d", player->id,
         player->fd, player->team, player->x, player->y, player->lvl);
     return player;
 }
 
 void update_player_actions(server_t *server)
 {
+    PROF_FUNC();
     player_t *player = NULL;
     action_t *action = NULL;
 
@@ -52,28 +56,18 @@ void update_player_actions(server_t *server)
         }
         action->remaining_ticks--;
         if (action->remaining_ticks <= 0) {
-            printf("Action prête : %s player %d\n",
+            log_trace("Action prête : %s player %d",
                 action->command, player->id);
         }
     }
 }
 
-static void send_player_death_to_gui(server_t *server, int player_id)
-{
-    for (int i = 1; i < NB_CONNECTION + 1; i++) {
-        if (server->clients[i].type == CLIENT_GUI &&
-            server->pfds[i].fd != FD_NULL) {
-            dprintf(server->pfds[i].fd, "pdi %d\n", player_id);
-        }
-    }
-}
-
-static bool consume_food(player_t *player)
+static bool consume_food(server_t *server, player_t *player)
 {
     if (!player) {
         return false;
     }
-    printf("ID: %d, FOOD_TICK: %d, FOOD: %d, LIFE: %d\n",
+    log_trace("ID: %d, FOOD_TICK: %d, FOOD: %d, LIFE: %d",
         player->id, player->food_tick, player->inventory[FOOD],
         player->life_remain);
     player->food_tick--;
@@ -82,6 +76,8 @@ static bool consume_food(player_t *player)
             player->inventory[FOOD]--;
             player->life_remain = 1260;
             player->food_tick = 126;
+            world_player_changed(server, player);
+            event_player(server, EVENT_PIN, player);
         } else {
             player->life_remain = 0;
         }
@@ -89,8 +85,27 @@ static bool consume_food(player_t *player)
     return player->life_remain > 0;
 }
 
+static void kill_player(server_t *server, player_t *player, int i)
+{
+    log_info("Player %d is dead", player->id);
+    ZAPPY_PROBE(player_death, player->id, player->x, player->y, player->lvl);
+    event_player(server, EVENT_PDI, player);
+    player_reply(server, player, "dead\n");
+    for (int k = 1; k < NB_CONNECTION + 1; k++)
+        if (server->clients[k].player == player &&
+            server->pfds[k].fd != FD_NULL)
+            cleanup_disconnected_client(server, k);
+    while (player->action_queue)
+        remove_action_from_queue(player);
+    world_player_removed(server, player);
+    mem_free(MEM_PLAYERS, player->team);
+    mem_free(MEM_PLAYERS, player);
+    server->players[i] = NULL;
+}
+
 void update_player_life(server_t *server)
 {
+    PROF_FUNC();
     player_t *player = NULL;
 
     for (int i = 0; i < server->player_nb; i++) {
@@ -99,15 +114,7 @@ void update_player_life(server_t *server)
             continue;
         }
         player->life_remain--;
-        if (!consume_food(player) || player->life_remain <= 0) {
-            printf("Player %d is dead\n", player->id);
-            send_player_death_to_gui(server, player->id);
-            dprintf(player->fd, "dead\n");
-            close(player->fd);
-            server->pfds[player->fd].fd = FD_NULL;
-            free(player->team);
-            free(player);
-            server->players[i] = NULL;
-        }
+        if (!consume_food(server, player) || player->life_remain <= 0)
+            kill_player(server, player, i);
     }
 }
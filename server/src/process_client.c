@@ -15,7 +15,7 @@
 #include <fcntl.h>
 #include <sys/time.h>
 
-int handle_tick(struct timeval *last_tick, server_config_t *config)
+long handle_tick(struct timeval *last_tick, server_config_t *config)
 {
     struct timeval now = {0};
     long elapsed_usec = 0;
@@ -25,9 +25,9 @@ int handle_tick(struct timeval *last_tick, server_config_t *config)
         + (now.tv_usec - last_tick->tv_usec);
     if (elapsed_usec >= config->tick_freq) {
         *last_tick = now;
-        return 1;
+        return elapsed_usec - config->tick_freq;
     }
-    return 0;
+    return -1;
 }
 
 void process_clients(server_t *server, server_config_t *config,
@@ -0,0 +1,102 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** profiler scopes and per-thread event buffers
+*/
+
+#include "prof.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+static struct {
+    atomic_bool enabled;
+    const char *path;
+    pthread_mutex_t lock;
+    prof_buffer_t *buffers;
+} prof = {false, NULL, PTHREAD_MUTEX_INITIALIZER, NULL};
+
+static __thread prof_buffer_t *local_buffer = NULL;
+
+static prof_buffer_t *thread_buffer(void)
+{
+    prof_buffer_t *buffer = calloc(1, sizeof(prof_buffer_t));
+
+    if (!buffer)
+        return NULL;
+    buffer->events = malloc(sizeof(prof_event_t) * PROF_BUFFER_EVENTS);
+    if (!buffer->events) {
+        free(buffer);
+        return NULL;
+    }
+    buffer->tid = syscall(SYS_gettid);
+    pthread_mutex_lock(&prof.lock);
+    buffer->next = prof.buffers;
+    prof.buffers = buffer;
+    pthread_mutex_unlock(&prof.lock);
+    return buffer;
+}
+
+prof_scope_t prof_begin(const char *name)
+{
+    prof_scope_t scope = {name, 0};
+    struct timespec now;
+
+    if (!atomic_load_explicit(&prof.enabled, memory_order_relaxed))
+        return scope;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    scope.start_ns = now.tv_sec * 1000000000ULL + now.tv_nsec;
+    return scope;
+}
+
+void prof_end(prof_scope_t *scope)
+{
+    struct timespec now;
+    prof_event_t *event = NULL;
+
+    if (!scope->start_ns)
+        return;
+    if (!local_buffer)
+        local_buffer = thread_buffer();
+    if (!local_buffer)
+        return;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    event = &local_buffer->events[local_buffer->count % PROF_BUFFER_EVENTS];
+    event->name = scope->name;
+    event->start_ns = scope->start_ns;
+    event->end_ns = now.tv_sec * 1000000000ULL + now.tv_nsec;
+    local_buffer->count++;
+}
+
+int prof_init(const char *path)
+{
+    prof.path = path;
+    atomic_store(&prof.enabled, path != NULL);
+    return 0;
+}
+
+void prof_shutdown(void)
+{
+    size_t len = prof.path ? strlen(prof.path) : 0;
+    prof_buffer_t *next = NULL;
+
+    if (!prof.path)
+        return;
+    atomic_store(&prof.enabled, false);
+    if (len > 5 && strcmp(prof.path + len - 5, ".json") == 0)
+        prof_write_chrome(prof.path, prof.buffers);
+    else
+        prof_write_folded(prof.path, prof.buffers);
+    for (prof_buffer_t *buffer = prof.buffers; buffer; buffer = next) {
+        next = buffer->next;
+        free(buffer->events);
+        free(buffer);
+    }
+    prof.buffers = NULL;
+}
@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** profiler export as Chrome trace-event JSON
+*/
+
+#include "prof.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static int compare_events(const void *a, const void *b)
+{
+    const prof_event_t *left = a;
+    const prof_event_t *right = b;
+
+    if (left->start_ns != right->start_ns)
+        return left->start_ns < right->start_ns ? -1 : 1;
+    if (left->end_ns != right->end_ns)
+        return left->end_ns > right->end_ns ? -1 : 1;
+    return 0;
+}
+
+size_t prof_sorted_events(prof_buffer_t *buffer, prof_event_t **out)
+{
+    size_t count = buffer->count < PROF_BUFFER_EVENTS ?
+        buffer->count : PROF_BUFFER_EVENTS;
+    size_t first = buffer->count - count;
+
+    *out = malloc(sizeof(prof_event_t) * (count ? count : 1));
+    if (!*out)
+        return 0;
+    for (size_t i = 0; i < count; i++)
+        (*out)[i] = buffer->events[(first + i) % PROF_BUFFER_EVENTS];
+    qsort(*out, count, sizeof(prof_event_t), &compare_events);
+    return count;
+}
+
+static void write_buffer(FILE *file, prof_buffer_t *buffer, bool *first)
+{
+    prof_event_t *events = NULL;
+    size_t count = prof_sorted_events(buffer, &events);
+
+    for (size_t i = 0; i < count; i++) {
+        fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,"
+            "\"dur\":%.3f,\"pid\":%d,\"tid\":%d}", *first ? "" : ",\n",
+            events[i].name, events[i].start_ns / 1000.0,
+            (events[i].end_ns - events[i].start_ns) / 1000.0,
+            (int)getpid(), buffer->tid);
+        *first = false;
+    }
+    free(events);
+}
+
+int prof_write_chrome(const char *path, prof_buffer_t *buffers)
+{
+    FILE *file = fopen(path, "w");
+    bool first = true;
+
+    if (!file)
+        return -1;
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (prof_buffer_t *buffer = buffers; buffer; buffer = buffer->next)
+        write_buffer(file, buffer, &first);
+    fprintf(file, "\n]}\n");
+    fclose(file);
+    return 0;
+}
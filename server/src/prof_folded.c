@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** profiler export as folded stacks for flamegraph tools
+*/
+
+#include "prof.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static size_t table_index(prof_folded_table_t *table, const char *path)
+{
+    prof_folded_t *entries = NULL;
+
+    for (size_t i = 0; i < table->count; i++) {
+        if (strcmp(table->entries[i].path, path) == 0)
+            return i;
+    }
+    if (table->count == table->cap) {
+        table->cap = table->cap ? table->cap * 2 : 64;
+        entries = realloc(table->entries, table->cap * sizeof(prof_folded_t));
+        if (!entries)
+            return SIZE_MAX;
+        table->entries = entries;
+    }
+    table->entries[table->count].path = strdup(path);
+    table->entries[table->count].self_ns = 0;
+    return table->count++;
+}
+
+static size_t path_index(prof_folded_table_t *table, prof_event_t *events,
+    size_t *stack, int depth)
+{
+    char path[1024] = "";
+    size_t len = 0;
+
+    for (int d = 0; d < depth && len < sizeof(path); d++)
+        len += snprintf(path + len, sizeof(path) - len, "%s%s",
+            d ? ";" : "", events[stack[d]].name);
+    return table_index(table, path);
+}
+
+static void fold_events(prof_folded_table_t *table, prof_event_t *events,
+    size_t count, int64_t *self)
+{
+    size_t stack[PROF_MAX_DEPTH];
+    size_t *index = malloc(sizeof(size_t) * (count ? count : 1));
+    int depth = 0;
+
+    for (size_t i = 0; index && i < count; i++) {
+        while (depth && (events[stack[depth - 1]].end_ns < events[i].end_ns
+            || events[stack[depth - 1]].end_ns <= events[i].start_ns))
+            depth--;
+        self[i] = events[i].end_ns - events[i].start_ns;
+        if (depth)
+            self[stack[depth - 1]] -= self[i];
+        stack[depth < PROF_MAX_DEPTH ? depth++ : depth - 1] = i;
+        index[i] = path_index(table, events, stack, depth);
+    }
+    for (size_t i = 0; index && i < count; i++) {
+        if (index[i] != SIZE_MAX && self[i] > 0)
+            table->entries[index[i]].self_ns += self[i];
+    }
+    free(index);
+}
+
+static void fold_buffer(prof_folded_table_t *table, prof_buffer_t *buffer)
+{
+    prof_event_t *events = NULL;
+    size_t count = prof_sorted_events(buffer, &events);
+    int64_t *self = malloc(sizeof(int64_t) * (count ? count : 1));
+
+    if (events && self)
+        fold_events(table, events, count, self);
+    free(self);
+    free(events);
+}
+
+int prof_write_folded(const char *path, prof_buffer_t *buffers)
+{
+    prof_folded_table_t table = {NULL, 0, 0};
+    FILE *file = fopen(path, "w");
+
+    if (!file)
+        return -1;
+    for (prof_buffer_t *buffer = buffers; buffer; buffer = buffer->next)
+        fold_buffer(&table, buffer);
+    for (size_t i = 0; i < table.count; i++) {
+        fprintf(file, "%s %llu\n", table.entries[i].path,
+            (unsigned long long)(table.entries[i].self_ns / 1000));
+        free(table.entries[i].path);
+    }
+    free(table.entries);
+    fclose(file);
+    return 0;
+}
@@ -37,8 +37,15 @@ void remove_action_from_queue(player_t *player)
     action_t *action = player->action_queue;
 
     player->action_queue = action->next;
-    free(action->command);
-    free(action);
+    ZAPPY_PROBE(action_done, player->id, action->command, action->ticks,
+        action->read_ns);
+    if (action->next) {
+        action->next->start_ns = metrics_now_ns();
+        ZAPPY_PROBE(action_start, player->id, action->next->command,
+            action->next->ticks);
+    }
+    mem_free(MEM_ACTIONS, action->command);
+    mem_free(MEM_ACTIONS, action);
 }
 
 void process_player_action(server_t *server, player_t *player)
@@ -55,16 +62,19 @@ void process_player_action(server_t *server, player_t *player)
         return;
     parse_command_args(command_copy, &cmd_name, &args);
     if (cmd_name) {
-        printf("Executing completed action: %s for player %d\n",
+        log_debug("Executing completed action: %s for player %d",
             cmd_name, player->id);
         execute_single_command(server, player, cmd_name, args);
+        metrics_action_done(server, cmd_name, action);
     }
-    free(command_copy);
+    mem_free(MEM_ACTIONS, command_copy);
     remove_action_from_queue(player);
 }
 
 void process_completed_actions(server_t *server)
 {
+    PROF_FUNC();
+
     for (int i = 0; i < server->player_nb; i++) {
         if (server->players[i])
             process_player_action(server, server->players[i]);
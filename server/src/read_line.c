@@ -0,0 +1,53 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** line framing of client input
+*/
+
+#include "server.h"
+#include <string.h>
+
+static void consume_lines(server_t *server, server_config_t *config, int i)
+{
+    client_t *client = &server->clients[i];
+    char *start = client->read_buf;
+    char *end = memchr(start, '\n', client->read_len);
+
+    while (end && server->pfds[i].fd != FD_NULL) {
+        *end = '\0';
+        record_input(server, RECORD_MESSAGE, i, start);
+        handle_client_message(server, i, start, config);
+        start = end + 1;
+        end = memchr(start, '\n',
+            client->read_len - (start - client->read_buf));
+    }
+    if (server->pfds[i].fd == FD_NULL) {
+        client->read_len = 0;
+        return;
+    }
+    client->read_len -= start - client->read_buf;
+    memmove(client->read_buf, start, client->read_len);
+}
+
+void read_client(server_t *server, server_config_t *config, int i)
+{
+    PROF_FUNC();
+    client_t *client = &server->clients[i];
+    int read_size = 0;
+
+    if (!(server->pfds[i].revents & POLLIN))
+        return;
+    if (client->read_len >= BUF_SIZE - 1)
+        client->read_len = 0;
+    read_size = read_client_data(server, i,
+        client->read_buf + client->read_len, BUF_SIZE - client->read_len);
+    if (read_size <= 0) {
+        client->read_len = 0;
+        return;
+    }
+    client->read_len += read_size;
+    client->read_ns = metrics_now_ns();
+    server->metrics.live.bytes_in += read_size;
+    consume_lines(server, config, i);
+}
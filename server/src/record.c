@@ -0,0 +1,52 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** input recorder: seed, arguments and every handled input
+*/
+
+#include "server.h"
+
+int record_open(server_t *server, server_config_t *config)
+{
+    server->record = fopen(config->record_path, "w");
+    if (!server->record) {
+        log_error("Cannot open record %s", config->record_path);
+        return FAILURE;
+    }
+    setvbuf(server->record, NULL, _IOFBF, RECORD_BUFFER);
+    fprintf(server->record, "%s\nseed %lu\n", RECORD_MAGIC,
+        (unsigned long)config->seed);
+    for (int i = 0; i < config->argc; i++)
+        fprintf(server->record, "arg %s\n", config->argv[i]);
+    fprintf(server->record, "%s\n", RECORD_HEADER_END);
+    return SUCCESS;
+}
+
+void record_input(server_t *server, record_kind_t kind, int slot,
+    const char *text)
+{
+    if (!server->record)
+        return;
+    fprintf(server->record, "%lu %c %d %s\n", server->tick, kind, slot,
+        text ? text : "");
+}
+
+/*
+** Called before every game tick: the inputs of a tick reach the file
+** before the next one runs, so a crash loses at most the current tick.
+*/
+void record_flush(server_t *server)
+{
+    if (server->record)
+        fflush(server->record);
+}
+
+void record_close(server_t *server)
+{
+    if (!server->record)
+        return;
+    record_input(server, RECORD_END, -1, NULL);
+    fclose(server->record);
+    server->record = NULL;
+}
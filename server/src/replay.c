@@ -0,0 +1,72 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** replay: run a recorded game without sockets or tick pacing
+*/
+
+#include "server.h"
+#include <string.h>
+
+static void replay_tick(server_t *server, int *tick_count)
+{
+    run_game_tick(server, tick_count);
+    event_bus_flush(&server->events);
+    journal_tick(server);
+    shm_world_publish(server);
+}
+
+/*
+** Inputs stamped with tick T were handled before game tick T + 1, so
+** ticks are run up to T first. Returns false at the end marker.
+*/
+static bool replay_line(server_t *server, char *line, int *tick_count)
+{
+    unsigned long tick = 0;
+    char kind = 0;
+    int slot = 0;
+    int offset = 0;
+
+    if (sscanf(line, "%lu %c %d%n", &tick, &kind, &slot, &offset) < 3)
+        return true;
+    while (server->tick < tick)
+        replay_tick(server, tick_count);
+    if (kind == RECORD_END)
+        return false;
+    line[strcspn(line, "\n")] = '\0';
+    replay_apply(server, kind, slot, line + offset + (line[offset] == ' '));
+    return true;
+}
+
+static FILE *open_inputs(const char *path, char **line, size_t *cap)
+{
+    FILE *file = fopen(path, "r");
+
+    while (file && getline(line, cap, file) > 0 &&
+        strncmp(*line, RECORD_HEADER_END, strlen(RECORD_HEADER_END)) != 0);
+    return file;
+}
+
+int replay_run(server_t *server, server_config_t *config)
+{
+    char *line = NULL;
+    size_t cap = 0;
+    FILE *file = open_inputs(config->replay_path, &line, &cap);
+    unsigned long inputs = 0;
+    int tick_count = server->tick % RESPAWN_TICKS;
+    uint64_t start_ns = metrics_now_ns();
+
+    if (!file)
+        return FAILURE;
+    server->config = config;
+    reset_server_clients(server);
+    while (getline(&line, &cap, file) > 0 &&
+        replay_line(server, line, &tick_count))
+        inputs++;
+    event_bus_flush(&server->events);
+    log_info("Replay: %lu inputs, %lu ticks in %.3f s", inputs,
+        server->tick, (metrics_now_ns() - start_ns) / 1e9);
+    free(line);
+    fclose(file);
+    return SUCCESS;
+}
@@ -0,0 +1,56 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** replay: feed one recorded input through the live handlers
+*/
+
+#include "server.h"
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+** Replies still go through write(): /dev/null keeps their cost and
+** drops the bytes.
+*/
+static void replay_connect(server_t *server, int slot)
+{
+    int fd = open("/dev/null", O_WRONLY);
+
+    add_client(fd, server);
+    if (fd < 0 || slot <= 0 || slot > NB_CONNECTION ||
+        server->pfds[slot].fd != fd)
+        log_warn("Replay: client %d landed in another slot", slot);
+}
+
+static void replay_admin(server_t *server, const char *text)
+{
+    admin_request_t request = {0};
+
+    strncpy(request.line, text, ADMIN_LINE - 1);
+    admin_execute(server, &request);
+    free(request.reply);
+}
+
+void replay_apply(server_t *server, record_kind_t kind, int slot,
+    const char *text)
+{
+    bool open = slot > 0 && slot <= NB_CONNECTION &&
+        server->pfds[slot].fd != FD_NULL;
+
+    if (kind == RECORD_CONNECT)
+        replay_connect(server, slot);
+    if (kind == RECORD_MESSAGE && open)
+        handle_client_message(server, slot, text, server->config);
+    if (kind == RECORD_READ_CLOSED && open) {
+        close(server->pfds[slot].fd);
+        server->pfds[slot].fd = FD_NULL;
+    }
+    if (kind == RECORD_HANGUP && open)
+        cleanup_disconnected_client(server, slot);
+    if (kind == RECORD_ADMIN)
+        replay_admin(server, text);
+    if (kind == RECORD_SHED)
+        server->metrics.live.shed.level = slot;
+}
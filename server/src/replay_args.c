@@ -0,0 +1,55 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** replay: read the command line back from a record header
+*/
+
+#include "server.h"
+#include <string.h>
+
+static int push_arg(char ***args, int *count, const char *arg)
+{
+    char **grown = realloc(*args, sizeof(char *) * (*count + 2));
+
+    if (!grown)
+        return -1;
+    *args = grown;
+    grown[*count] = strdup(arg);
+    grown[*count + 1] = NULL;
+    if (!grown[*count])
+        return -1;
+    (*count)++;
+    return 0;
+}
+
+void replay_free_args(char **args, int count)
+{
+    for (int i = 0; args && i < count; i++)
+        free(args[i]);
+    free(args);
+}
+
+char **replay_read_args(FILE *file, int *count, uint64_t *seed)
+{
+    char *line = NULL;
+    size_t cap = 0;
+    char **args = NULL;
+    int status = 0;
+
+    if (getline(&line, &cap, file) <= 0 ||
+        strncmp(line, RECORD_MAGIC, strlen(RECORD_MAGIC)) != 0)
+        status = -1;
+    while (status == 0 && getline(&line, &cap, file) > 0 &&
+        strncmp(line, RECORD_HEADER_END, strlen(RECORD_HEADER_END)) != 0) {
+        line[strcspn(line, "\n")] = '\0';
+        if (strncmp(line, "arg ", 4) != 0)
+            sscanf(line, "seed %lu", seed);
+        else
+            status = push_arg(&args, count, line + 4);
+    }
+    free(line);
+    if (status < 0)
+        replay_free_args(args, *count);
+    return status < 0 ? NULL : args;
+}
@@ -0,0 +1,75 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** replay: rebuild the configuration from a record header
+*/
+
+#include "server.h"
+#include <string.h>
+
+/*
+** The world and its seed come from the record; where the output goes
+** comes from the replay command line. No socket, admin, checkpoint or
+** new record during a replay.
+*/
+static void keep_outputs(server_config_t *config,
+    const server_config_t *live, uint64_t seed)
+{
+    config->seed = seed;
+    config->seeded = true;
+    config->log_level = live->log_level;
+    config->log_path = live->log_path;
+    config->prof_path = live->prof_path;
+    config->shm_name = live->shm_name;
+    config->journal_path = live->journal_path;
+    config->replay_path = live->replay_path;
+    config->admin_path = NULL;
+    config->record_path = NULL;
+    config->checkpoint_path = NULL;
+    config->headless = true;
+}
+
+/*
+** Team names and the restore path still point into the header args,
+** which are freed once parsed.
+*/
+static int own_strings(server_config_t *config)
+{
+    for (int i = 0; i < config->team_nb; i++) {
+        config->team_name[i] = strdup(config->team_name[i]);
+        if (!config->team_name[i])
+            return -1;
+    }
+    if (config->restore_path) {
+        config->restore_path = strdup(config->restore_path);
+        if (!config->restore_path)
+            return -1;
+    }
+    config->argc = 0;
+    config->argv = NULL;
+    return 0;
+}
+
+int replay_config(server_config_t *config)
+{
+    server_config_t live = *config;
+    FILE *file = fopen(live.replay_path, "r");
+    uint64_t seed = 0;
+    int count = 0;
+    char **args = file ? replay_read_args(file, &count, &seed) : NULL;
+    int status = 0;
+
+    if (file)
+        fclose(file);
+    memset(config, 0, sizeof(server_config_t));
+    status = args && parse_args(count, args, config) == 0 ?
+        own_strings(config) : -1;
+    replay_free_args(args, count);
+    if (status < 0) {
+        printf("Error: Invalid record %s\n", live.replay_path);
+        return -1;
+    }
+    keep_outputs(config, &live, seed);
+    return 0;
+}
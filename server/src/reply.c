@@ -0,0 +1,51 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** player replies: to the socket, or to the embedder's sink
+*/
+
+#include "server.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+static char *format_reply(char *line, int *len, const char *format,
+    va_list args)
+{
+    va_list copy;
+    char *text = line;
+
+    va_copy(copy, args);
+    *len = vsnprintf(line, REPLY_LINE, format, args);
+    if (*len >= REPLY_LINE) {
+        text = mem_alloc(MEM_RESPONSES, *len + 1);
+        if (text)
+            vsnprintf(text, *len + 1, format, copy);
+    }
+    va_end(copy);
+    return text;
+}
+
+void player_reply(server_t *server, player_t *player, const char *format,
+    ...)
+{
+    va_list args;
+    char line[REPLY_LINE];
+    char *text = NULL;
+    int len = 0;
+
+    if (!server->reply.fn && player->fd == FD_NULL)
+        return;
+    va_start(args, format);
+    if (!server->reply.fn) {
+        vdprintf(player->fd, format, args);
+        va_end(args);
+        return;
+    }
+    text = format_reply(line, &len, format, args);
+    va_end(args);
+    if (text && len > 0)
+        server->reply.fn(server->reply.ctx, player->id, text, len);
+    if (text != line)
+        mem_free(MEM_RESPONSES, text);
+}
@@ -0,0 +1,65 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** xoshiro256** generator and bounded draws
+*/
+
+#include "rng.h"
+
+static uint64_t rotl(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+uint64_t rng_next(rng_t *rng)
+{
+    uint64_t *s = rng->s;
+    uint64_t result = rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return result;
+}
+
+/*
+** Lemire's multiply-shift: unbiased, one division only on rejection.
+*/
+uint32_t rng_below(rng_t *rng, uint32_t bound)
+{
+    uint64_t m = (rng_next(rng) >> 32) * bound;
+    uint32_t threshold = 0;
+
+    if ((uint32_t)m < bound) {
+        threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (rng_next(rng) >> 32) * bound;
+    }
+    return m >> 32;
+}
+
+/*
+** Bulk placement: both halves of every draw are used and the rejection
+** threshold is computed once for the whole batch.
+*/
+void rng_fill_below(rng_t *rng, uint32_t *out, size_t count,
+    uint32_t bound)
+{
+    uint32_t threshold = -bound % bound;
+    uint64_t word = 0;
+    uint64_t m = 0;
+    size_t i = 0;
+
+    for (int half = 0; i < count; half ^= 1) {
+        if (!half)
+            word = rng_next(rng);
+        m = (half ? word >> 32 : word & UINT32_MAX) * bound;
+        if ((uint32_t)m >= threshold)
+            out[i++] = m >> 32;
+    }
+}
@@ -0,0 +1,57 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** world seed and per-subsystem stream setup
+*/
+
+#include "server.h"
+#include <time.h>
+#include <unistd.h>
+
+static uint64_t splitmix64(uint64_t *x)
+{
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static void rng_jump(rng_t *rng)
+{
+    static const uint64_t jump[] = {0x180ec6d33cfd0abaULL,
+        0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+    uint64_t s[4] = {0};
+
+    for (int i = 0; i < 4; i++)
+        for (int b = 0; b < 64; b++) {
+            if (jump[i] & (1ULL << b)) {
+                s[0] ^= rng->s[0];
+                s[1] ^= rng->s[1];
+                s[2] ^= rng->s[2];
+                s[3] ^= rng->s[3];
+            }
+            rng_next(rng);
+        }
+    for (int i = 0; i < 4; i++)
+        rng->s[i] = s[i];
+}
+
+void rng_streams_init(rng_t *streams, int count, uint64_t seed)
+{
+    for (int i = 0; i < 4; i++)
+        streams[0].s[i] = splitmix64(&seed);
+    for (int i = 1; i < count; i++) {
+        streams[i] = streams[i - 1];
+        rng_jump(&streams[i]);
+    }
+}
+
+void init_rng(server_t *server, server_config_t *config)
+{
+    if (!config->seeded)
+        config->seed = (uint64_t)time(NULL) ^ ((uint64_t)getpid() << 32);
+    rng_streams_init(server->rng, RNG_STREAMS, config->seed);
+    log_info("World seed: %lu", (unsigned long)config->seed);
+}
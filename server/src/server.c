@@ -5,7 +5,7 @@
 ** TCP server
 */
 
-#include "server.h"
+#include "gui.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -33,7 +33,7 @@ void create_server(server_t *server)
     return;
 }
 
-static void add_client(int client_fd, server_t *server)
+void add_client(int client_fd, server_t *server)
 {
     for (int i = 1; i < NB_CONNECTION + 1; i++) {
         if (server->pfds[i].fd == FD_NULL) {
@@ -42,7 +42,10 @@ static void add_client(int client_fd, server_t *server)
             server->clients[i].fd = client_fd;
             server->clients[i].type = -1;
             server->clients[i].player = NULL;
+            server->clients[i].read_len = 0;
+            gui_unsubscribe_view(server, i);
             server->nb_clients += 1;
+            record_input(server, RECORD_CONNECT, i, NULL);
             write(client_fd, "WELCOME\n", 8);
             return;
         }
@@ -79,13 +82,15 @@ void reset_server_clients(server_t *server)
     }
 }
 
-void read_client(server_t *server, server_config_t *config, int i)
+void display_server_info(server_config_t *config)
 {
-    char buffer[1024] = {0};
-
-    if (server->pfds[i].revents & POLLIN) {
-        if (read_client_data(server, i, buffer, sizeof(buffer)) > 0) {
-            handle_client_message(server, i, buffer, config);
-        }
+    log_info("Server launched: port=%d, freq=%d, teams=%d",
+        config->port, config->freq, config->team_nb);
+    if (config->warp)
+        log_info("Warp mode: lockstep ticks, cap %d ticks/s (0 = none)",
+            config->warp_cap);
+    for (int i = 0; i < config->team_nb; i++) {
+        log_info("Team %d: %s (max_players=%d)",
+            i, config->teams[i].name, config->teams[i].max_players);
     }
 }
@@ -0,0 +1,95 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** world setup and teardown shared by the server and zappy_bench
+*/
+
+#include "server.h"
+#include "commands.h"
+
+static int init_map_world(server_t *server, server_config_t *config)
+{
+    server->map = mem_calloc(MEM_MAP, 1, sizeof(map_t));
+    server->checkpoint.path = config->checkpoint_path;
+    if (config->restore_path && checkpoint_restore(server, config) < 0)
+        return FAILURE;
+    if (!config->restore_path) {
+        init_rng(server, config);
+        init_map(server->map, config->width, config->height);
+        generate_resources(server->map, &server->rng[RNG_MAP]);
+    }
+    server->checkpoint.next_tick = server->tick + CHECKPOINT_TICKS;
+    init_interest(&server->interest, config->width, config->height);
+    return SUCCESS;
+}
+
+int init_world(server_t *server, server_config_t *config)
+{
+    server->port = config->port;
+    server->fd = FD_NULL;
+    if (!config->headless)
+        create_server(server);
+    if (init_map_world(server, config) != SUCCESS)
+        return FAILURE;
+    if (config->shm_name && shm_world_open(server, config->shm_name))
+        return FAILURE;
+    init_mct(server);
+    init_sync(server);
+    budget_init(server);
+    metrics_init(server);
+    event_bus_setup(server);
+    if (config->journal_path && journal_open(server, config))
+        return FAILURE;
+    if (config->record_path && record_open(server, config))
+        return FAILURE;
+    if (config->admin_path && admin_start(server, config->admin_path))
+        return FAILURE;
+    return SUCCESS;
+}
+
+static void free_players(server_t *server)
+{
+    for (int i = 0; i < server->player_nb; i++) {
+        if (!server->players[i])
+            continue;
+        while (server->players[i]->action_queue)
+            remove_action_from_queue(server->players[i]);
+        mem_free(MEM_PLAYERS, server->players[i]->team);
+        mem_free(MEM_PLAYERS, server->players[i]);
+        server->players[i] = NULL;
+    }
+}
+
+/*
+** Everything owned by one world; process-wide state (logger, profiler,
+** memory report) is left to cleanup_server.
+*/
+void free_world(server_t *server)
+{
+    record_close(server);
+    checkpoint_poll(server, true);
+    free_players(server);
+    if (server->map)
+        free_map(server->map);
+    admin_stop(server);
+    free_interest(&server->interest);
+    free_sync(server);
+    budget_free(server);
+    journal_close(server);
+    event_bus_free(&server->events);
+    free_mct(server);
+    shm_world_close(server);
+}
+
+void cleanup_server(server_t *server)
+{
+    if (!server)
+        return;
+    metrics_report(server);
+    free_world(server);
+    mem_report();
+    free(server);
+    prof_shutdown();
+    log_shutdown();
+}
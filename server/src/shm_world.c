@@ -0,0 +1,62 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** shared-memory world publisher for same-host observers
+*/
+
+#include "server.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+static void write_header(shm_world_t *shm, map_t *map)
+{
+    shm_world_header_t *header = shm->base;
+
+    header->magic = SHM_WORLD_MAGIC;
+    header->version = SHM_WORLD_VERSION;
+    header->width = map->width;
+    header->height = map->height;
+    header->pid = getpid();
+}
+
+int shm_world_open(server_t *server, const char *name)
+{
+    shm_world_t *shm = &server->shm;
+    int fd = shm_open(name, O_CREAT | O_RDWR | O_TRUNC, 0644);
+
+    if (fd < 0) {
+        perror("shm_open");
+        return FAILURE;
+    }
+    shm->size = shm_world_size(server->map->width, server->map->height);
+    if (ftruncate(fd, shm->size) < 0) {
+        perror("ftruncate");
+        close(fd);
+        shm_unlink(name);
+        return FAILURE;
+    }
+    shm->base = mmap(NULL, shm->size, PROT_READ | PROT_WRITE, MAP_SHARED,
+        fd, 0);
+    close(fd);
+    if (shm->base == MAP_FAILED) {
+        shm->base = NULL;
+        shm_unlink(name);
+        return FAILURE;
+    }
+    shm->name = name;
+    write_header(shm, server->map);
+    return SUCCESS;
+}
+
+void shm_world_close(server_t *server)
+{
+    if (!server->shm.base)
+        return;
+    munmap(server->shm.base, server->shm.size);
+    shm_unlink(server->shm.name);
+    server->shm.base = NULL;
+}
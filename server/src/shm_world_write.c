@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** seqlock-guarded writes into the shared world region
+*/
+
+#include "server.h"
+#include <string.h>
+
+static void begin_write(shm_world_t *shm)
+{
+    shm_world_header_t *header = shm->base;
+
+    if (shm->writing)
+        return;
+    __atomic_store_n(&header->seq, header->seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    shm->writing = true;
+}
+
+void shm_world_tile(server_t *server, int x, int y)
+{
+    shm_world_t *shm = &server->shm;
+    int index = y * server->map->width + x;
+
+    if (!shm->base)
+        return;
+    begin_write(shm);
+    for (int i = 0; i < RESOURCE_COUNT; i++)
+        shm_world_plane(shm->base, i)[index] =
+            server->map->tiles[y][x].resources[i];
+}
+
+void shm_world_player(server_t *server, player_t *player, bool active)
+{
+    shm_world_player_t *slot;
+
+    if (!server->shm.base || player->id < 0 ||
+        player->id >= SHM_PLAYER_SLOTS)
+        return;
+    begin_write(&server->shm);
+    slot = &shm_world_players(server->shm.base)[player->id];
+    slot->id = player->id;
+    slot->x = player->x;
+    slot->y = player->y;
+    slot->dir = player->dir + 1;
+    slot->lvl = player->lvl;
+    slot->active = active;
+    for (int i = 0; i < RESOURCE_COUNT; i++)
+        slot->inventory[i] = player->inventory[i];
+    strncpy(slot->team, player->team, SHM_TEAM_SIZE - 1);
+    slot->team[SHM_TEAM_SIZE - 1] = '\0';
+}
+
+void shm_world_event(server_t *server, const char *line)
+{
+    shm_world_header_t *header = server->shm.base;
+    shm_world_event_t *slot;
+    uint64_t index;
+
+    if (!header)
+        return;
+    index = header->event_head;
+    slot = &shm_world_events(header)[index % SHM_EVENT_SLOTS];
+    __atomic_store_n(&slot->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    slot->tick = server->tick;
+    strncpy(slot->line, line, SHM_EVENT_SIZE - 1);
+    slot->line[SHM_EVENT_SIZE - 1] = '\0';
+    __atomic_store_n(&slot->seq, index + 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&header->event_head, index + 1, __ATOMIC_RELEASE);
+}
+
+void shm_world_publish(server_t *server)
+{
+    PROF_FUNC();
+    shm_world_header_t *header = server->shm.base;
+
+    if (!header)
+        return;
+    if (header->tick != server->tick ||
+        header->freq != (uint32_t)server->config->freq) {
+        begin_write(&server->shm);
+        header->tick = server->tick;
+        header->freq = server->config->freq;
+    }
+    if (!server->shm.writing)
+        return;
+    __atomic_store_n(&header->seq, header->seq + 1, __ATOMIC_RELEASE);
+    server->shm.writing = false;
+}
@@ -0,0 +1,78 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** libzappy_sim: world and agent lifetime
+*/
+
+#include "sim.h"
+#include "commands.h"
+#include <string.h>
+
+zappy_sim_t *zappy_sim_create(const zappy_sim_config_t *config)
+{
+    zappy_sim_t *sim = calloc(1, sizeof(zappy_sim_t));
+
+    if (!sim)
+        return NULL;
+    sim->server = calloc(1, sizeof(server_t));
+    if (!sim->server || sim_config(&sim->config, config) < 0 ||
+        init_world(sim->server, &sim->config) != SUCCESS) {
+        zappy_sim_destroy(sim);
+        return NULL;
+    }
+    sim->server->config = &sim->config;
+    reset_server_clients(sim->server);
+    zappy_sim_on_reply(sim, NULL, NULL);
+    return sim;
+}
+
+void zappy_sim_destroy(zappy_sim_t *sim)
+{
+    if (!sim)
+        return;
+    if (sim->server) {
+        free_world(sim->server);
+        free(sim->server);
+    }
+    sim_config_free(&sim->config);
+    free(sim->buffer);
+    free(sim);
+}
+
+void zappy_sim_on_reply(zappy_sim_t *sim, zappy_reply_fn fn, void *ctx)
+{
+    sim->server->reply.fn = fn ? fn : sim_buffer_reply;
+    sim->server->reply.ctx = fn ? ctx : sim;
+}
+
+int zappy_sim_add_agent(zappy_sim_t *sim, const char *team_name)
+{
+    team_t *team = find_team(team_name, &sim->config);
+    player_t *player = NULL;
+
+    if (!team || team->actual_players >= team->max_players)
+        return -1;
+    player = spawn_player(sim->server, team, FD_NULL);
+    return player ? player->id : -1;
+}
+
+/*
+** Same entry point as a line read from an AI socket: timed commands are
+** queued, Connect_nbr answers at once.
+*/
+int zappy_sim_submit(zappy_sim_t *sim, int agent, const char *command)
+{
+    char line[BUF_SIZE];
+    player_t *player = NULL;
+
+    if (agent < 0 || agent >= sim->server->player_nb ||
+        !sim->server->players[agent] || !command)
+        return -1;
+    player = sim->server->players[agent];
+    strncpy(line, command, BUF_SIZE - 1);
+    line[BUF_SIZE - 1] = '\0';
+    player->read_ns = metrics_now_ns();
+    execute_command(sim->server, player, line);
+    return 0;
+}
@@ -0,0 +1,74 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** libzappy_sim: server configuration from the embedder's
+*/
+
+#include "sim.h"
+#include <string.h>
+
+static int sim_teams(server_config_t *config, const zappy_sim_config_t *from)
+{
+    config->team_nb = from->team_nb;
+    config->team_name = calloc(from->team_nb, sizeof(char *));
+    config->teams = calloc(from->team_nb, sizeof(team_t));
+    if (!config->team_name || !config->teams)
+        return -1;
+    for (int i = 0; i < from->team_nb; i++) {
+        config->team_name[i] = strdup(from->teams[i]);
+        config->teams[i].name = strdup(from->teams[i]);
+        if (!config->team_name[i] || !config->teams[i].name)
+            return -1;
+        config->teams[i].max_players = from->clients_per_team;
+    }
+    return 0;
+}
+
+int sim_config(server_config_t *config, const zappy_sim_config_t *from)
+{
+    if (from->width <= 0 || from->height <= 0 || from->team_nb <= 0 ||
+        !from->teams || from->clients_per_team <= 0)
+        return -1;
+    config->width = from->width;
+    config->height = from->height;
+    config->nb_clients = from->clients_per_team;
+    config->freq = from->freq > 0 ? from->freq : 100;
+    config->tick_freq = 1000000 / config->freq;
+    config->seed = from->seed;
+    config->seeded = true;
+    config->log_level = LOG_OFF;
+    config->headless = true;
+    return sim_teams(config, from);
+}
+
+void sim_config_free(server_config_t *config)
+{
+    for (int i = 0; config->team_name && i < config->team_nb; i++)
+        free(config->team_name[i]);
+    for (int i = 0; config->teams && i < config->team_nb; i++)
+        free(config->teams[i].name);
+    free(config->team_name);
+    free(config->teams);
+}
+
+void sim_buffer_reply(void *ctx, int agent, const char *line, size_t len)
+{
+    zappy_sim_t *sim = ctx;
+    char prefix[16];
+    int width = snprintf(prefix, sizeof(prefix), "%d ", agent);
+    size_t need = sim->len + width + len + 1;
+    char *grown = sim->buffer;
+
+    if (need > sim->cap) {
+        grown = realloc(sim->buffer, need * 2);
+        if (!grown)
+            return;
+        sim->buffer = grown;
+        sim->cap = need * 2;
+    }
+    memcpy(sim->buffer + sim->len, prefix, width);
+    memcpy(sim->buffer + sim->len + width, line, len);
+    sim->len += width + len;
+    sim->buffer[sim->len] = '\0';
+}
@@ -0,0 +1,42 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** libzappy_sim: ticks and world queries
+*/
+
+#include "sim.h"
+
+void zappy_sim_step(zappy_sim_t *sim, unsigned long ticks)
+{
+    for (unsigned long i = 0; i < ticks; i++) {
+        run_game_tick(sim->server, &sim->tick_count);
+        event_bus_flush(&sim->server->events);
+    }
+}
+
+/*
+** The buffer stays valid until the next call into the simulation.
+*/
+const char *zappy_sim_drain(zappy_sim_t *sim, size_t *len)
+{
+    *len = sim->len;
+    sim->len = 0;
+    return *len ? sim->buffer : "";
+}
+
+unsigned long zappy_sim_tick(const zappy_sim_t *sim)
+{
+    return sim->server->tick;
+}
+
+uint64_t zappy_sim_digest(const zappy_sim_t *sim)
+{
+    return sim->server->sync.digest;
+}
+
+bool zappy_sim_alive(const zappy_sim_t *sim, int agent)
+{
+    return agent >= 0 && agent < sim->server->player_nb &&
+        sim->server->players[agent] != NULL;
+}
@@ -0,0 +1,32 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** region hash grid lifetime
+*/
+
+#include "server.h"
+
+void init_sync(server_t *server)
+{
+    sync_grid_t *grid = &server->sync;
+
+    grid->cols = (server->map->width + SYNC_REGION - 1) / SYNC_REGION;
+    grid->rows = (server->map->height + SYNC_REGION - 1) / SYNC_REGION;
+    grid->digest = 0;
+    grid->hashes = mem_calloc(MEM_GUI, grid->cols * grid->rows,
+        sizeof(uint64_t));
+    for (int y = 0; y < server->map->height; y++) {
+        for (int x = 0; x < server->map->width; x++)
+            world_tile_changed(server, x, y);
+    }
+    for (int i = 0; i < server->player_nb; i++)
+        if (server->players[i])
+            world_player_changed(server, server->players[i]);
+}
+
+void free_sync(server_t *server)
+{
+    mem_free(MEM_GUI, server->sync.hashes);
+    server->sync.hashes = NULL;
+}
@@ -0,0 +1,40 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** tile and player state hashes (must match the GUI RegionSync)
+*/
+
+#include "sync.h"
+#include "map.h"
+
+uint64_t sync_mix(uint64_t value)
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+uint64_t hash_tile_state(int x, int y, const int *resources)
+{
+    uint64_t hash = sync_mix(SYNC_TILE_SEED ^ (uint32_t)x);
+
+    hash = sync_mix(hash ^ (uint32_t)y);
+    for (int r = 0; r < RESOURCE_COUNT; r++)
+        hash = sync_mix(hash ^ (uint32_t)resources[r]);
+    return hash;
+}
+
+uint64_t hash_player_state(const int *fields, const int *inventory)
+{
+    uint64_t hash = SYNC_PLAYER_SEED;
+
+    for (int f = 0; f < 5; f++)
+        hash = sync_mix(hash ^ (uint32_t)fields[f]);
+    for (int r = 0; r < RESOURCE_COUNT; r++)
+        hash = sync_mix(hash ^ (uint32_t)inventory[r]);
+    return hash;
+}
@@ -5,6 +5,7 @@
 ** TCP server
 */
 
+#define _GNU_SOURCE
 #include "server.h"
 #include "commands.h"
 #include <stdlib.h>
@@ -17,49 +18,73 @@
 
 int wait_activity(server_t *server, int timeout_ms)
 {
+    PROF_FUNC();
+    uint64_t timeout_ns = 0;
+    struct timespec timeout = {0};
+
     if (timeout_ms == 0)
         timeout_ms = 1;
-    return poll(server->pfds, NB_CONNECTION + 1, timeout_ms);
+    timeout_ns = (uint64_t)timeout_ms * 1000000ULL;
+    if (server->config->warp)
+        timeout_ns = warp_timeout(server, timeout_ns);
+    timeout.tv_sec = timeout_ns / 1000000000ULL;
+    timeout.tv_nsec = timeout_ns % 1000000000ULL;
+    return ppoll(server->pfds, NB_CONNECTION + 1, &timeout, NULL);
 }
 
-void handle_game_tick(server_t *server, server_config_t *config,
-    struct timeval *last_tick, int *tick_count)
+void run_game_tick(server_t *server, int *tick_count)
 {
-    if (!handle_tick(last_tick, config))
-        return;
+    PROF_FUNC();
+
+    server->tick++;
+    ZAPPY_PROBE(tick_begin, server->tick, server->player_nb);
     update_game_state(server);
     update_player_life(server);
+    budget_respawn(server, *tick_count);
     (*tick_count)++;
-    if (*tick_count >= 20) {
-        generate_resources(server->map);
+    if (*tick_count % BUDGET_CONFLATE_TICKS == 0)
+        budget_flush_tiles(server);
+    if (*tick_count >= RESPAWN_TICKS) {
         send_gui_resource_changes(server);
         *tick_count = 0;
     }
+    ZAPPY_PROBE(tick_end, server->tick);
 }
 
-static void handle_player_death(player_t *player)
+void handle_game_tick(server_t *server, server_config_t *config,
+    struct timeval *last_tick, int *tick_count)
 {
-    printf("Player %d died\n", player->id);
-    dprintf(player->fd, "dead\n");
-    close(player->fd);
+    long late_usec = config->warp ? warp_tick(server, last_tick) :
+        handle_tick(last_tick, config);
+    uint64_t start_ns = 0;
+
+    checkpoint_poll(server, false);
+    if (late_usec < 0 || admin_hold(server))
+        return;
+    budget_tick(server);
+    record_flush(server);
+    start_ns = metrics_now_ns();
+    run_game_tick(server, tick_count);
+    metrics_tick(server, start_ns, late_usec);
+    metrics_publish(server);
+    if (config->warp)
+        warp_report(server);
 }
 
-static void consume_food(player_t *player)
+static void consume_food(server_t *server, player_t *player)
 {
     player->inventory[FOOD]--;
+    world_player_changed(server, player);
+    event_player(server, EVENT_PIN, player);
     player->life_remain = 1260;
-    printf("Player %d consumed food, life reset\n", player->id);
+    log_debug("Player %d consumed food, life reset", player->id);
 }
 
-void update_single_player_life(player_t *player)
+void update_single_player_life(server_t *server, player_t *player)
 {
     if (!player)
         return;
     player->life_remain--;
-    if (player->life_remain > 0)
-        return;
-    if (player->inventory[FOOD] > 0)
-        consume_food(player);
-    else
-        handle_player_death(player);
+    if (player->life_remain <= 0 && player->inventory[FOOD] > 0)
+        consume_food(server, player);
 }
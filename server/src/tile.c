@@ -20,7 +20,7 @@ bool add_tile_to_response(response_context_t *ctx,
 char *create_element_string(const char *name, int value)
 {
     size_t needed_size = strlen(name) + 20;
-    char *element = malloc(needed_size);
+    char *element = mem_alloc(MEM_RESPONSES, needed_size);
 
     if (!element)
         return NULL;
@@ -48,7 +48,7 @@ bool add_tile_players(tile_context_t *tile_ctx, response_context_t *resp_ctx)
     if (!element)
         return false;
     add_element_to_response(resp_ctx, element);
-    free(element);
+    mem_free(MEM_RESPONSES, element);
     return true;
 }
 
@@ -66,7 +66,7 @@ bool add_tile_resources(tile_context_t *tile_ctx, response_context_t *resp_ctx)
         if (!element)
             return false;
         add_element_to_response(resp_ctx, element);
-        free(element);
+        mem_free(MEM_RESPONSES, element);
     }
     return true;
 }
@@ -0,0 +1,88 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** warp: tick as soon as every AI is busy or idle, not on the clock
+*/
+
+#include "server.h"
+#include "commands.h"
+#include <unistd.h>
+
+/*
+** 1 when every connected AI has an action queued (Idle counts), 0 when
+** one is still thinking, -1 when no AI is connected.
+*/
+static int warp_ready(server_t *server)
+{
+    int ready = -1;
+
+    for (int i = 1; i < NB_CONNECTION + 1; i++) {
+        if (server->pfds[i].fd == FD_NULL || !server->clients[i].player ||
+            server->clients[i].type != CLIENT_IA)
+            continue;
+        if (!server->clients[i].player->action_queue)
+            return 0;
+        ready = 1;
+    }
+    return ready;
+}
+
+static uint64_t warp_remaining_ns(server_t *server, uint64_t now)
+{
+    uint64_t period = 0;
+
+    if (server->config->warp_cap <= 0)
+        return 0;
+    period = 1000000000ULL / server->config->warp_cap;
+    if (now - server->warp.last_ns >= period)
+        return 0;
+    return server->warp.last_ns + period - now;
+}
+
+/*
+** Without an AI there is nothing to wait for: the world keeps the -f
+** pace so eggs and food still run out at a human speed.
+*/
+long warp_tick(server_t *server, struct timeval *last_tick)
+{
+    int ready = warp_ready(server);
+    uint64_t now = metrics_now_ns();
+
+    if (ready < 0)
+        return handle_tick(last_tick, server->config);
+    if (ready == 0 || warp_remaining_ns(server, now) > 0)
+        return -1;
+    server->warp.last_ns = now;
+    gettimeofday(last_tick, NULL);
+    return 0;
+}
+
+/*
+** In nanoseconds: a millisecond poll timeout would truncate the last
+** sub-millisecond wait to 0 and spin until the tick is due.
+*/
+uint64_t warp_timeout(server_t *server, uint64_t timeout_ns)
+{
+    if (warp_ready(server) <= 0)
+        return timeout_ns;
+    return warp_remaining_ns(server, metrics_now_ns());
+}
+
+void warp_report(server_t *server)
+{
+    warp_t *warp = &server->warp;
+    uint64_t now = metrics_now_ns();
+
+    if (!warp->window_ns) {
+        warp->window_ns = now;
+        warp->window_tick = server->tick;
+    }
+    if (now - warp->window_ns < WARP_REPORT_NS)
+        return;
+    warp->tps = (server->tick - warp->window_tick) * 1e9 /
+        (now - warp->window_ns);
+    warp->window_ns = now;
+    warp->window_tick = server->tick;
+    log_info("Warp: %.0f ticks/s at tick %lu", warp->tps, server->tick);
+}
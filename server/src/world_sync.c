@@ -0,0 +1,53 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** world mutation hooks keeping region hashes up to date
+*/
+
+#include "server.h"
+
+static int region_of(server_t *server, int x, int y)
+{
+    return (y / SYNC_REGION) * server->sync.cols + x / SYNC_REGION;
+}
+
+void world_tile_changed(server_t *server, int x, int y)
+{
+    tile_t *tile = &server->map->tiles[y][x];
+    uint64_t hash = hash_tile_state(x, y, tile->resources);
+
+    shm_world_tile(server, x, y);
+    if (server->mct.dirty)
+        server->mct.dirty[y] = true;
+    if (!server->sync.hashes)
+        return;
+    server->sync.hashes[region_of(server, x, y)] ^= tile->hash ^ hash;
+    server->sync.digest ^= tile->hash ^ hash;
+    tile->hash = hash;
+}
+
+void world_player_removed(server_t *server, player_t *player)
+{
+    shm_world_player(server, player, false);
+    if (player->region >= 0 && server->sync.hashes) {
+        server->sync.hashes[player->region] ^= player->hash;
+        server->sync.digest ^= player->hash;
+    }
+    player->region = -1;
+}
+
+void world_player_changed(server_t *server, player_t *player)
+{
+    int fields[5] = {player->id, player->x, player->y, player->dir + 1,
+        player->lvl};
+
+    world_player_removed(server, player);
+    shm_world_player(server, player, true);
+    if (!server->sync.hashes)
+        return;
+    player->hash = hash_player_state(fields, player->inventory);
+    player->region = region_of(server, player->x, player->y);
+    server->sync.hashes[player->region] ^= player->hash;
+    server->sync.digest ^= player->hash;
+}
@@ -0,0 +1,49 @@
+/*
+** EPITECH PROJECT, 2025
+** bench.h
+** File description:
+** zappy_bench headless simulation benchmark
+*/
+
+#ifndef BENCH_H_
+    #define BENCH_H_
+    #include "server.h"
+    #define BENCH_MIX_MAX 16
+    #define BENCH_DEPTH_MAX 10
+    #define BENCH_SCRIPT_SEED 0x42454e43ULL
+
+/*
+** A mix is a bag of commands drawn uniformly: repeating an entry
+** weights it.
+*/
+typedef struct {
+    const char *name;
+    const char *commands[BENCH_MIX_MAX];
+} bench_mix_t;
+
+typedef struct {
+    int width;
+    int height;
+    int players;
+    unsigned long ticks;
+    int depth;
+    uint64_t seed;
+    const bench_mix_t *mix;
+} bench_config_t;
+
+typedef struct {
+    server_t *server;
+    server_config_t config;
+    rng_t script;
+    unsigned long commands;
+    uint64_t elapsed_ns;
+} bench_t;
+
+const bench_mix_t *bench_mix_find(const char *name);
+void bench_mix_list(FILE *out);
+const char *bench_mix_next(const bench_mix_t *mix, rng_t *rng);
+int bench_world_init(bench_t *bench, const bench_config_t *config);
+void bench_world_free(bench_t *bench);
+void bench_run(bench_t *bench, const bench_config_t *config);
+void bench_report(const bench_t *bench, const bench_config_t *config);
+#endif /* !BENCH_H_ */
@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_bench command mixes
+*/
+
+#include "bench.h"
+#include <string.h>
+
+/*
+** No mix drops food, so bots live through the run. fork only bumps
+** eggs_available: no egg is laid and nobody hatches.
+*/
+static const bench_mix_t mixes[] = {
+    {"default", {"Forward", "Forward", "Right", "Left", "Look",
+        "Inventory", "Take food", "Set linemate", "Take linemate",
+        "Broadcast hello", NULL}},
+    {"look", {"Look", "Look", "Look", "Look", "Look", "Look", "Forward",
+        "Right", "Left", "Inventory", NULL}},
+    {"broadcast", {"Broadcast rally at the north-east corner",
+        "Broadcast rally at the north-east corner", "Broadcast hello",
+        "Broadcast hello", "Broadcast hello", "Broadcast hello",
+        "Forward", "Right", "Look", NULL}},
+    {"fork", {"Fork", "Fork", "Fork", "Fork", "Fork", "Fork", "Forward",
+        "Right", "Inventory", NULL}},
+    {"eject", {"Eject", "Eject", "Eject", "Forward", "Left", "Look",
+        "Take food", NULL}},
+    {NULL, {NULL}}
+};
+
+const bench_mix_t *bench_mix_find(const char *name)
+{
+    for (int i = 0; mixes[i].name; i++)
+        if (strcmp(mixes[i].name, name) == 0)
+            return &mixes[i];
+    return NULL;
+}
+
+void bench_mix_list(FILE *out)
+{
+    for (int i = 0; mixes[i].name; i++)
+        fprintf(out, "%s%s", i ? ", " : "", mixes[i].name);
+    fprintf(out, "\n");
+}
+
+const char *bench_mix_next(const bench_mix_t *mix, rng_t *rng)
+{
+    uint32_t count = 0;
+
+    while (count < BENCH_MIX_MAX && mix->commands[count])
+        count++;
+    return mix->commands[rng_below(rng, count)];
+}
@@ -0,0 +1,95 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_bench lockstep driver and report
+*/
+
+#include "bench.h"
+#include "commands.h"
+#include <string.h>
+
+static const char *phase_names[BUDGET_PHASES] = {"input", "sim", "publish"};
+
+static int queue_length(const player_t *player)
+{
+    int length = 0;
+
+    for (const action_t *action = player->action_queue; action;
+        action = action->next)
+        length++;
+    return length;
+}
+
+static void bench_command(bench_t *bench, const bench_config_t *config,
+    player_t *player)
+{
+    char command[BUF_SIZE];
+
+    strncpy(command, bench_mix_next(config->mix, &bench->script),
+        BUF_SIZE - 1);
+    command[BUF_SIZE - 1] = '\0';
+    player->read_ns = metrics_now_ns();
+    execute_command(bench->server, player, command);
+    bench->commands++;
+}
+
+/*
+** Every live player is topped up to depth queued actions, the way a
+** pipelining AI keeps its socket busy.
+*/
+static void bench_feed(bench_t *bench, const bench_config_t *config)
+{
+    player_t *player = NULL;
+
+    for (int i = 0; i < bench->server->player_nb; i++) {
+        player = bench->server->players[i];
+        if (!player)
+            continue;
+        for (int n = queue_length(player); n < config->depth; n++)
+            bench_command(bench, config, player);
+    }
+}
+
+void bench_run(bench_t *bench, const bench_config_t *config)
+{
+    server_t *server = bench->server;
+    uint64_t start_ns = metrics_now_ns();
+    uint64_t now = start_ns;
+    int tick_count = 0;
+
+    for (unsigned long tick = 0; tick < config->ticks; tick++) {
+        bench_feed(bench, config);
+        now = budget_charge(server, BUDGET_IO, now);
+        run_game_tick(server, &tick_count);
+        now = budget_charge(server, BUDGET_SIM, now);
+        event_bus_flush(&server->events);
+        shm_world_publish(server);
+        now = budget_charge(server, BUDGET_PUBLISH, now);
+    }
+    bench->elapsed_ns = now - start_ns;
+}
+
+void bench_report(const bench_t *bench, const bench_config_t *config)
+{
+    const server_t *server = bench->server;
+    double seconds = bench->elapsed_ns / 1e9;
+    int alive = 0;
+
+    for (int i = 0; i < server->player_nb; i++)
+        alive += server->players[i] != NULL;
+    printf("map %dx%d, %d players, mix %s, depth %d, seed %lu\n",
+        config->width, config->height, config->players, config->mix->name,
+        config->depth, config->seed);
+    printf("ticks %lu in %.3f s: %.1f ticks/s\n", server->tick, seconds,
+        server->tick / seconds);
+    printf("commands %lu: %.1f commands/s\n", bench->commands,
+        bench->commands / seconds);
+    for (int i = 0; i < BUDGET_PHASES; i++)
+        printf("phase %s %.3f s (%.1f%%) %.2f us/tick\n", phase_names[i],
+            server->budget.busy_ns[i] / 1e9, server->budget.busy_ns[i] *
+            100.0 / bench->elapsed_ns, server->budget.busy_ns[i] / 1e3 /
+            server->tick);
+    printf("players alive %d\ndigest %016lx\n", alive,
+        (unsigned long)server->sync.digest);
+}
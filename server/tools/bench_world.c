@@ -0,0 +1,78 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_bench world setup: the server's own init, no socket
+*/
+
+#include "bench.h"
+#include <string.h>
+
+/*
+** Same path as the command line so the benchmark runs the configuration
+** the server would.
+*/
+static int bench_config(bench_t *bench, const bench_config_t *config)
+{
+    char value[4][24];
+    char *args[] = {"zappy_bench", "-p", "1", "-x", value[0], "-y",
+        value[1], "-n", "red", "blue", "-c", value[2], "-f", "100", "-s",
+        value[3], "-l", "warn", NULL};
+
+    snprintf(value[0], sizeof(value[0]), "%d", config->width);
+    snprintf(value[1], sizeof(value[1]), "%d", config->height);
+    snprintf(value[2], sizeof(value[2]), "%d", (config->players + 1) / 2);
+    snprintf(value[3], sizeof(value[3]), "%lu", config->seed);
+    if (parse_args(sizeof(args) / sizeof(args[0]) - 1, args,
+        &bench->config) < 0)
+        return -1;
+    bench->config.argc = 0;
+    bench->config.argv = NULL;
+    bench->config.headless = true;
+    return 0;
+}
+
+/*
+** Pseudo-clients have no descriptor, like restored players: replies are
+** dropped unformatted. They carry food for the whole run so the load
+** stays constant.
+*/
+static int bench_spawn(server_t *server, team_t *team, unsigned long ticks)
+{
+    player_t *player = spawn_player(server, team, FD_NULL);
+
+    if (!player)
+        return -1;
+    player->inventory[FOOD] += ticks / 126 + 1;
+    world_player_changed(server, player);
+    return 0;
+}
+
+int bench_world_init(bench_t *bench, const bench_config_t *config)
+{
+    bench->server = calloc(1, sizeof(server_t));
+    if (!bench->server || bench_config(bench, config) < 0)
+        return -1;
+    if (log_init(bench->config.log_level, NULL) < 0 ||
+        init_world(bench->server, &bench->config) != SUCCESS)
+        return -1;
+    bench->server->config = &bench->config;
+    reset_server_clients(bench->server);
+    for (int i = 0; i < config->players; i++)
+        if (bench_spawn(bench->server, &bench->config.teams[i % 2],
+            config->ticks) < 0)
+            return -1;
+    rng_streams_init(&bench->script, 1, config->seed ^ BENCH_SCRIPT_SEED);
+    event_bus_flush(&bench->server->events);
+    return 0;
+}
+
+void bench_world_free(bench_t *bench)
+{
+    cleanup_server(bench->server);
+    bench->server = NULL;
+    for (int i = 0; i < bench->config.team_nb; i++)
+        free(bench->config.teams[i].name);
+    free(bench->config.teams);
+    free(bench->config.team_name);
+}
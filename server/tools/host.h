@@ -0,0 +1,96 @@
+/*
+** EPITECH PROJECT, 2025
+** host.h
+** File description:
+** zappy_host: many worlds in one process on a work-stealing pool
+*/
+
+#ifndef HOST_H_
+    #define HOST_H_
+    #include <pthread.h>
+    #include <signal.h>
+    #include <stdatomic.h>
+    #include <sys/time.h>
+    #include "server.h"
+    #define HOST_GAMES_MAX 256
+    #define HOST_WORKERS_MAX 64
+    #define HOST_EVENTS 64
+    #define HOST_HANDSHAKE 32
+    #define HOST_BACKLOG 128
+    #define HOST_TAG_LISTEN 1ULL
+    #define HOST_TAG_PENDING 2ULL
+    #define HOST_TAG_WORLD 3ULL
+
+/*
+** A world is on at most one deque at a time: QUEUED means queued or
+** running, DIRTY that an event came in meanwhile and it must run again.
+*/
+typedef enum {
+    WORLD_IDLE,
+    WORLD_QUEUED,
+    WORLD_DIRTY
+} world_state_t;
+
+typedef struct {
+    int id;
+    server_t *server;
+    server_config_t config;
+    struct timeval last_tick;
+    int tick_count;
+    int timer_fd;
+    bool armed;
+    atomic_int state;
+    pthread_mutex_t inbox_lock;
+    int inbox[NB_CONNECTION];
+    int inbox_nb;
+} host_world_t;
+
+/*
+** The owner pushes and pops at the bottom, thieves take from the top.
+*/
+typedef struct {
+    pthread_mutex_t lock;
+    host_world_t *tasks[HOST_GAMES_MAX];
+    unsigned long top;
+    unsigned long bottom;
+} host_deque_t;
+
+typedef struct host_s host_t;
+
+typedef struct {
+    host_t *host;
+    int index;
+    pthread_t thread;
+    host_deque_t deque;
+    unsigned long runs;
+    unsigned long steals;
+} host_worker_t;
+
+struct host_s {
+    server_config_t base;
+    host_world_t *worlds;
+    int world_nb;
+    host_worker_t *workers;
+    int worker_nb;
+    pthread_mutex_t idle_lock;
+    pthread_cond_t idle_cond;
+    atomic_int pending;
+    atomic_bool stopping;
+    atomic_uint next_worker;
+    int epoll_fd;
+    int listen_fd;
+};
+
+int host_world_init(host_t *host, host_world_t *world, int id);
+void host_world_free(host_world_t *world);
+void host_world_run(host_world_t *world);
+int host_world_adopt(host_world_t *world, int fd);
+void host_deque_push(host_deque_t *deque, host_world_t *world);
+host_world_t *host_deque_take(host_deque_t *deque, bool steal);
+void host_push(host_t *host, host_world_t *world, int worker);
+void host_notify(host_t *host, host_world_t *world);
+int host_pool_start(host_t *host);
+void host_pool_stop(host_t *host);
+int host_listen(host_t *host);
+void host_reactor(host_t *host, volatile sig_atomic_t *stop);
+#endif /* !HOST_H_ */
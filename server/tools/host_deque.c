@@ -0,0 +1,63 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_host: per-worker deques and world wake-ups
+*/
+
+#include "host.h"
+
+void host_deque_push(host_deque_t *deque, host_world_t *world)
+{
+    pthread_mutex_lock(&deque->lock);
+    deque->tasks[deque->bottom % HOST_GAMES_MAX] = world;
+    deque->bottom++;
+    pthread_mutex_unlock(&deque->lock);
+}
+
+/*
+** The owner takes its newest task (still hot in its cache), a thief the
+** oldest one.
+*/
+host_world_t *host_deque_take(host_deque_t *deque, bool steal)
+{
+    host_world_t *world = NULL;
+
+    pthread_mutex_lock(&deque->lock);
+    if (deque->bottom > deque->top) {
+        if (steal) {
+            world = deque->tasks[deque->top % HOST_GAMES_MAX];
+            deque->top++;
+        } else {
+            deque->bottom--;
+            world = deque->tasks[deque->bottom % HOST_GAMES_MAX];
+        }
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return world;
+}
+
+void host_push(host_t *host, host_world_t *world, int worker)
+{
+    if (worker < 0)
+        worker = atomic_fetch_add(&host->next_worker, 1) % host->worker_nb;
+    host_deque_push(&host->workers[worker].deque, world);
+    pthread_mutex_lock(&host->idle_lock);
+    atomic_fetch_add(&host->pending, 1);
+    pthread_cond_signal(&host->idle_cond);
+    pthread_mutex_unlock(&host->idle_lock);
+}
+
+void host_notify(host_t *host, host_world_t *world)
+{
+    int state = atomic_load(&world->state);
+    int next = WORLD_QUEUED;
+
+    while (state != WORLD_DIRTY) {
+        next = state == WORLD_IDLE ? WORLD_QUEUED : WORLD_DIRTY;
+        if (atomic_compare_exchange_weak(&world->state, &state, next))
+            break;
+    }
+    if (state == WORLD_IDLE && next == WORLD_QUEUED)
+        host_push(host, world, -1);
+}
@@ -0,0 +1,101 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_host: work-stealing worker threads
+*/
+
+#include "host.h"
+
+static host_world_t *find_task(host_worker_t *worker)
+{
+    host_t *host = worker->host;
+    host_world_t *world = host_deque_take(&worker->deque, false);
+    int victim = 0;
+
+    for (int i = 1; !world && i < host->worker_nb; i++) {
+        victim = (worker->index + i) % host->worker_nb;
+        world = host_deque_take(&host->workers[victim].deque, true);
+        if (world)
+            worker->steals++;
+    }
+    if (world)
+        atomic_fetch_sub(&host->pending, 1);
+    return world;
+}
+
+/*
+** A world that was notified while running goes back on this worker's own
+** deque instead of being lost.
+*/
+static void run_task(host_worker_t *worker, host_world_t *world)
+{
+    int state = WORLD_QUEUED;
+
+    host_world_run(world);
+    worker->runs++;
+    if (atomic_compare_exchange_strong(&world->state, &state, WORLD_IDLE))
+        return;
+    atomic_store(&world->state, WORLD_QUEUED);
+    host_push(worker->host, world, worker->index);
+}
+
+static void *worker_main(void *arg)
+{
+    host_worker_t *worker = arg;
+    host_t *host = worker->host;
+    host_world_t *world = NULL;
+
+    while (!atomic_load(&host->stopping)) {
+        world = find_task(worker);
+        if (world) {
+            run_task(worker, world);
+            continue;
+        }
+        pthread_mutex_lock(&host->idle_lock);
+        while (atomic_load(&host->pending) == 0 &&
+            !atomic_load(&host->stopping))
+            pthread_cond_wait(&host->idle_cond, &host->idle_lock);
+        pthread_mutex_unlock(&host->idle_lock);
+    }
+    return NULL;
+}
+
+int host_pool_start(host_t *host)
+{
+    host->workers = calloc(host->worker_nb, sizeof(host_worker_t));
+    if (!host->workers)
+        return -1;
+    pthread_mutex_init(&host->idle_lock, NULL);
+    pthread_cond_init(&host->idle_cond, NULL);
+    for (int i = 0; i < host->worker_nb; i++) {
+        host->workers[i].host = host;
+        host->workers[i].index = i;
+        pthread_mutex_init(&host->workers[i].deque.lock, NULL);
+    }
+    for (int i = 0; i < host->worker_nb; i++) {
+        if (pthread_create(&host->workers[i].thread, NULL, worker_main,
+            &host->workers[i]) != 0) {
+            host->worker_nb = i;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+void host_pool_stop(host_t *host)
+{
+    pthread_mutex_lock(&host->idle_lock);
+    atomic_store(&host->stopping, true);
+    pthread_cond_broadcast(&host->idle_cond);
+    pthread_mutex_unlock(&host->idle_lock);
+    for (int i = 0; i < host->worker_nb; i++) {
+        pthread_join(host->workers[i].thread, NULL);
+        log_info("Worker %d: %lu runs, %lu steals", i,
+            host->workers[i].runs, host->workers[i].steals);
+        pthread_mutex_destroy(&host->workers[i].deque.lock);
+    }
+    free(host->workers);
+    pthread_mutex_destroy(&host->idle_lock);
+    pthread_cond_destroy(&host->idle_cond);
+}
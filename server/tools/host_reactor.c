@@ -0,0 +1,114 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_host: shared acceptor, GAME handshake and world wake-ups
+*/
+
+#include "host.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+int host_listen(host_t *host)
+{
+    struct sockaddr_in addr = {0};
+    struct epoll_event event = {EPOLLIN, {.u64 = HOST_TAG_LISTEN << 32}};
+    int yes = 1;
+
+    host->listen_fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    if (host->listen_fd < 0)
+        return -1;
+    setsockopt(host->listen_fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = INADDR_ANY;
+    addr.sin_port = htons(host->base.port);
+    if (bind(host->listen_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+        listen(host->listen_fd, HOST_BACKLOG) < 0) {
+        perror("zappy_host: listen");
+        return -1;
+    }
+    return epoll_ctl(host->epoll_fd, EPOLL_CTL_ADD, host->listen_fd, &event);
+}
+
+static void accept_clients(host_t *host)
+{
+    struct epoll_event event = {EPOLLIN | EPOLLET, {0}};
+    int fd = accept(host->listen_fd, NULL, NULL);
+
+    while (fd >= 0) {
+        event.data.u64 = HOST_TAG_PENDING << 32 | (uint32_t)fd;
+        if (epoll_ctl(host->epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0)
+            close(fd);
+        fd = accept(host->listen_fd, NULL, NULL);
+    }
+}
+
+/*
+** Once routed, the descriptor stays in the acceptor's epoll set but only
+** wakes its world up; the world reads it itself.
+*/
+static void route_client(host_t *host, int fd, int id)
+{
+    struct epoll_event event = {EPOLLIN | EPOLLET | EPOLLRDHUP,
+        {.u64 = HOST_TAG_WORLD << 32 | (uint32_t)id}};
+
+    if (id < 0 || id >= host->world_nb ||
+        host_world_adopt(&host->worlds[id], fd) < 0) {
+        dprintf(fd, "ko\n");
+        epoll_ctl(host->epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+        close(fd);
+        return;
+    }
+    epoll_ctl(host->epoll_fd, EPOLL_CTL_MOD, fd, &event);
+    host_notify(host, &host->worlds[id]);
+}
+
+/*
+** Only the "GAME <id>\n" line is consumed: whatever the client pipelined
+** behind it is left in the socket for the world.
+*/
+static void handshake(host_t *host, int fd)
+{
+    char line[HOST_HANDSHAKE + 1] = {0};
+    ssize_t len = recv(fd, line, HOST_HANDSHAKE, MSG_PEEK | MSG_DONTWAIT);
+    char *end = len > 0 ? memchr(line, '\n', len) : NULL;
+    int id = -1;
+
+    if (len == 0 || (len < 0 && errno != EAGAIN) ||
+        (!end && len == HOST_HANDSHAKE)) {
+        route_client(host, fd, -1);
+        return;
+    }
+    if (!end)
+        return;
+    recv(fd, line, end - line + 1, 0);
+    *end = '\0';
+    if (sscanf(line, "GAME %d", &id) != 1)
+        id = -1;
+    route_client(host, fd, id);
+}
+
+void host_reactor(host_t *host, volatile sig_atomic_t *stop)
+{
+    struct epoll_event events[HOST_EVENTS];
+    int ready = 0;
+    uint32_t tag = 0;
+    uint32_t value = 0;
+
+    while (!*stop) {
+        ready = epoll_wait(host->epoll_fd, events, HOST_EVENTS, 1000);
+        for (int i = 0; i < ready; i++) {
+            tag = events[i].data.u64 >> 32;
+            value = (uint32_t)events[i].data.u64;
+            if (tag == HOST_TAG_LISTEN)
+                accept_clients(host);
+            if (tag == HOST_TAG_PENDING)
+                handshake(host, value);
+            if (tag == HOST_TAG_WORLD)
+                host_notify(host, &host->worlds[value]);
+        }
+    }
+}
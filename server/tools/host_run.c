@@ -0,0 +1,58 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_host: one scheduling quantum of a world
+*/
+
+#include "host.h"
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+static void take_inbox(host_world_t *world)
+{
+    pthread_mutex_lock(&world->inbox_lock);
+    for (int i = 0; i < world->inbox_nb; i++)
+        add_client(world->inbox[i], world->server);
+    world->inbox_nb = 0;
+    pthread_mutex_unlock(&world->inbox_lock);
+}
+
+/*
+** A world without clients does not tick and has no timer armed, so it
+** costs nothing until someone joins it. The timer runs at twice the tick
+** rate so handle_tick() never misses a due tick by a whole period.
+*/
+static void set_timer(host_world_t *world, bool armed)
+{
+    long period_ns = (long)world->config.tick_freq * 500;
+    struct itimerspec spec = {{period_ns / 1000000000,
+        period_ns % 1000000000}, {period_ns / 1000000000,
+        period_ns % 1000000000}};
+    struct itimerspec off = {0};
+
+    if (world->armed == armed)
+        return;
+    world->armed = armed;
+    if (armed)
+        gettimeofday(&world->last_tick, NULL);
+    timerfd_settime(world->timer_fd, 0, armed ? &spec : &off, NULL);
+}
+
+void host_world_run(host_world_t *world)
+{
+    server_t *server = world->server;
+    uint64_t expirations = 0;
+
+    if (read(world->timer_fd, &expirations, sizeof(expirations)) < 0)
+        expirations = 0;
+    take_inbox(world);
+    set_timer(world, server->nb_clients > 0);
+    if (!world->armed)
+        return;
+    poll(server->pfds, NB_CONNECTION + 1, 0);
+    budget_log_floor(server);
+    server_step(server, &world->config, &world->last_tick,
+        &world->tick_count);
+    set_timer(world, server->nb_clients > 0);
+}
@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_host: one world, its inbox of routed clients and its tick timer
+*/
+
+#include "host.h"
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+/*
+** Every world gets its own team counters and seed; journals, records,
+** checkpoints, shm and the admin socket are per-process features and
+** stay off.
+*/
+static int world_config(host_t *host, host_world_t *world, int id)
+{
+    server_config_t *config = &world->config;
+
+    *config = host->base;
+    config->teams = calloc(config->team_nb, sizeof(team_t));
+    if (!config->teams)
+        return -1;
+    for (int i = 0; i < config->team_nb; i++) {
+        config->teams[i] = host->base.teams[i];
+        config->teams[i].name = strdup(host->base.teams[i].name);
+    }
+    config->seed = host->base.seed + id;
+    config->headless = true;
+    config->journal_path = NULL;
+    config->record_path = NULL;
+    config->checkpoint_path = NULL;
+    config->restore_path = NULL;
+    config->shm_name = NULL;
+    config->admin_path = NULL;
+    return 0;
+}
+
+int host_world_init(host_t *host, host_world_t *world, int id)
+{
+    struct epoll_event event = {EPOLLIN | EPOLLET,
+        {.u64 = HOST_TAG_WORLD << 32 | (uint64_t)id}};
+
+    world->id = id;
+    world->server = calloc(1, sizeof(server_t));
+    if (!world->server || world_config(host, world, id) < 0 ||
+        init_world(world->server, &world->config) != SUCCESS)
+        return -1;
+    world->server->config = &world->config;
+    reset_server_clients(world->server);
+    gettimeofday(&world->last_tick, NULL);
+    pthread_mutex_init(&world->inbox_lock, NULL);
+    world->timer_fd = timerfd_create(CLOCK_MONOTONIC,
+        TFD_NONBLOCK | TFD_CLOEXEC);
+    if (world->timer_fd < 0)
+        return -1;
+    return epoll_ctl(host->epoll_fd, EPOLL_CTL_ADD, world->timer_fd, &event);
+}
+
+void host_world_free(host_world_t *world)
+{
+    if (world->server) {
+        free_world(world->server);
+        free(world->server);
+    }
+    for (int i = 0; world->config.teams && i < world->config.team_nb; i++)
+        free(world->config.teams[i].name);
+    free(world->config.teams);
+    if (world->timer_fd > 0)
+        close(world->timer_fd);
+    pthread_mutex_destroy(&world->inbox_lock);
+}
+
+/*
+** Called by the acceptor; the world itself takes the descriptor over on
+** its next run.
+*/
+int host_world_adopt(host_world_t *world, int fd)
+{
+    int queued = -1;
+
+    pthread_mutex_lock(&world->inbox_lock);
+    if (world->inbox_nb < NB_CONNECTION) {
+        world->inbox[world->inbox_nb++] = fd;
+        queued = 0;
+    }
+    pthread_mutex_unlock(&world->inbox_lock);
+    return queued;
+}
@@ -0,0 +1,39 @@
+/*
+** EPITECH PROJECT, 2025
+** journal_cli.h
+** File description:
+** zappy_journal query tool
+*/
+
+#ifndef JOURNAL_CLI_H_
+    #define JOURNAL_CLI_H_
+    #include <stdbool.h>
+    #include "journal.h"
+
+typedef struct {
+    const char *map;
+    size_t length;
+    const journal_header_t *header;
+    const journal_index_t *index;
+    size_t index_nb;
+    size_t index_length;
+} journal_file_t;
+
+typedef struct {
+    int player;
+    uint32_t from;
+    uint32_t until;
+    bool types[EVENT_TYPES];
+    bool typed;
+    bool stats;
+    bool digests;
+    unsigned long counts[EVENT_TYPES];
+    unsigned long keyframes;
+} journal_query_t;
+
+int journal_file_open(journal_file_t *file, const char *path);
+void journal_file_close(journal_file_t *file);
+size_t journal_seek(const journal_file_t *file, uint32_t tick);
+void journal_query(const journal_file_t *file, journal_query_t *query);
+void journal_print(const journal_record_t *record, journal_query_t *query);
+#endif /* !JOURNAL_CLI_H_ */
@@ -0,0 +1,46 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_journal record printing
+*/
+
+#include "journal_cli.h"
+
+static void print_marker(const journal_record_t *record,
+    journal_query_t *query)
+{
+    uint64_t digest = (uint64_t)(uint32_t)record->value << 32 |
+        (uint32_t)record->id;
+
+    if (record->type == JOURNAL_DIGEST) {
+        if (query->digests)
+            printf("%u %016lx\n", record->tick, (unsigned long)digest);
+        return;
+    }
+    query->keyframes++;
+    if (!query->stats && !query->digests && !query->typed &&
+        query->player < 0)
+        printf("%u keyframe\n", record->tick);
+}
+
+void journal_print(const journal_record_t *record, journal_query_t *query)
+{
+    char line[JOURNAL_RECORD_MAX * 2];
+    event_t event;
+    const char *text = NULL;
+
+    if (record->type >= EVENT_TYPES) {
+        print_marker(record, query);
+        return;
+    }
+    if (query->digests || (query->typed && !query->types[record->type]) ||
+        (query->player >= 0 && (record->id != query->player ||
+        record->type == EVENT_BCT || record->type == EVENT_SST)))
+        return;
+    query->counts[record->type]++;
+    text = journal_decode(record, &event);
+    event_encode_text(line, sizeof(line), &event, text);
+    if (!query->stats)
+        printf("%u %s", record->tick, line);
+}
@@ -0,0 +1,96 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** journal mapping, tick index lookup and record scan
+*/
+
+#include "journal_cli.h"
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char *map_file(const char *path, size_t *length)
+{
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    void *map = MAP_FAILED;
+
+    *length = 0;
+    if (fd < 0)
+        return NULL;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+        map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return NULL;
+    *length = st.st_size;
+    return map;
+}
+
+int journal_file_open(journal_file_t *file, const char *path)
+{
+    char index_path[PATH_MAX];
+
+    file->map = map_file(path, &file->length);
+    file->header = (const journal_header_t *)file->map;
+    if (!file->map || file->length < sizeof(journal_header_t) ||
+        file->header->magic != JOURNAL_MAGIC ||
+        file->header->version != JOURNAL_VERSION) {
+        fprintf(stderr, "%s: not a zappy journal\n", path);
+        return -1;
+    }
+    snprintf(index_path, sizeof(index_path), "%s.idx", path);
+    file->index = (const journal_index_t *)map_file(index_path,
+        &file->index_length);
+    file->index_nb = file->index_length / sizeof(journal_index_t);
+    return 0;
+}
+
+void journal_file_close(journal_file_t *file)
+{
+    if (file->map)
+        munmap((void *)file->map, file->length);
+    if (file->index)
+        munmap((void *)file->index, file->index_length);
+}
+
+/*
+** Offset of the last indexed record strictly before tick: every record
+** from there on is in tick order, so nothing of tick itself is skipped.
+*/
+size_t journal_seek(const journal_file_t *file, uint32_t tick)
+{
+    size_t low = 0;
+    size_t high = file->index_nb;
+    size_t mid = 0;
+
+    while (low < high) {
+        mid = (low + high) / 2;
+        if (file->index[mid].tick < tick)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    if (low == 0)
+        return file->header->header_size;
+    return file->index[low - 1].offset;
+}
+
+void journal_query(const journal_file_t *file, journal_query_t *query)
+{
+    size_t offset = journal_seek(file, query->from);
+    const journal_record_t *record = NULL;
+
+    while (offset + sizeof(journal_record_t) <= file->length) {
+        record = (const journal_record_t *)(file->map + offset);
+        if (record->size < sizeof(journal_record_t) ||
+            record->tick > query->until)
+            break;
+        if (record->tick >= query->from)
+            journal_print(record, query);
+        offset += record->size;
+    }
+}
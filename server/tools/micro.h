@@ -0,0 +1,73 @@
+/*
+** EPITECH PROJECT, 2025
+** micro.h
+** File description:
+** zappy_micro: per-function microbenchmarks on bench fixtures
+*/
+
+#ifndef MICRO_H_
+    #define MICRO_H_
+    #include "bench.h"
+    #define MICRO_MAP 1
+    #define MICRO_PLAYERS 2
+    #define MICRO_VISION 4
+    #define MICRO_LIST_MAX 16
+    #define MICRO_SAMPLES_MAX 64
+
+typedef struct {
+    bench_t bench;
+    int level;
+    int null_fd;
+} micro_world_t;
+
+typedef void (*micro_fn_t)(micro_world_t *world, unsigned long i);
+
+/*
+** params lists the fixture dimensions the function depends on: the
+** others are held at their first value instead of being swept.
+*/
+typedef struct {
+    const char *name;
+    micro_fn_t fn;
+    int params;
+} micro_case_t;
+
+typedef struct {
+    int widths[MICRO_LIST_MAX];
+    int heights[MICRO_LIST_MAX];
+    int size_nb;
+    int players[MICRO_LIST_MAX];
+    int player_nb;
+    int levels[MICRO_LIST_MAX];
+    int level_nb;
+    const char *filter;
+    const char *json_path;
+    int samples;
+    uint64_t sample_ns;
+    uint64_t seed;
+} micro_config_t;
+
+typedef struct {
+    const micro_case_t *bench;
+    bench_config_t fixture;
+    int level;
+    unsigned long iterations;
+    double ns_per_op;
+    double min_ns;
+} micro_result_t;
+
+extern const micro_case_t micro_cases[];
+void micro_look(micro_world_t *world, unsigned long i);
+void micro_inventory(micro_world_t *world, unsigned long i);
+void micro_count_players(micro_world_t *world, unsigned long i);
+void micro_eject(micro_world_t *world, unsigned long i);
+int micro_parse(int ac, char **av, micro_config_t *config);
+int micro_usage(const char *name);
+int micro_world_init(micro_world_t *world, const bench_config_t *fixture,
+    int level);
+void micro_world_free(micro_world_t *world);
+int micro_run_case(const micro_config_t *config, micro_result_t *result);
+void micro_print(FILE *out, const micro_result_t *result);
+int micro_write_json(const char *path, const micro_result_t *results,
+    int count);
+#endif /* !MICRO_H_ */
@@ -0,0 +1,88 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_micro command line: comma-separated fixture lists
+*/
+
+#include "micro.h"
+#include <string.h>
+#include <unistd.h>
+
+int micro_usage(const char *name)
+{
+    fprintf(stderr, "USAGE: %s [-m WxH,...] [-n players,...]"
+        " [-v level,...] [-f filter] [-o results.json] [-S samples]"
+        " [-t ms_per_sample] [-s seed]\n       benchmarks:", name);
+    for (int i = 0; micro_cases[i].name; i++)
+        fprintf(stderr, " %s", micro_cases[i].name);
+    fprintf(stderr, "\n");
+    return 84;
+}
+
+static int parse_list(char *arg, int *values, int *count, int max)
+{
+    char *save = NULL;
+
+    *count = 0;
+    for (char *item = strtok_r(arg, ",", &save); item;
+        item = strtok_r(NULL, ",", &save)) {
+        if (*count == MICRO_LIST_MAX || atoi(item) <= 0 ||
+            atoi(item) > max)
+            return -1;
+        values[(*count)++] = atoi(item);
+    }
+    return *count > 0 ? 0 : -1;
+}
+
+static int parse_sizes(char *arg, micro_config_t *config)
+{
+    char *save = NULL;
+
+    config->size_nb = 0;
+    for (char *item = strtok_r(arg, ",", &save); item;
+        item = strtok_r(NULL, ",", &save)) {
+        if (config->size_nb == MICRO_LIST_MAX ||
+            sscanf(item, "%dx%d", &config->widths[config->size_nb],
+            &config->heights[config->size_nb]) != 2 ||
+            config->widths[config->size_nb] <= 0 ||
+            config->heights[config->size_nb] <= 0)
+            return -1;
+        config->size_nb++;
+    }
+    return config->size_nb > 0 ? 0 : -1;
+}
+
+static int parse_option(int opt, micro_config_t *config)
+{
+    if (opt == 'm')
+        return parse_sizes(optarg, config);
+    if (opt == 'n')
+        return parse_list(optarg, config->players, &config->player_nb,
+            MAX_PLAYERS);
+    if (opt == 'v')
+        return parse_list(optarg, config->levels, &config->level_nb, 8);
+    if (opt == 'f')
+        config->filter = optarg;
+    if (opt == 'o')
+        config->json_path = optarg;
+    if (opt == 'S')
+        config->samples = atoi(optarg);
+    if (opt == 't')
+        config->sample_ns = strtoull(optarg, NULL, 10) * 1000000;
+    if (opt == 's')
+        config->seed = strtoull(optarg, NULL, 10);
+    return opt == '?' ? -1 : 0;
+}
+
+int micro_parse(int ac, char **av, micro_config_t *config)
+{
+    int opt = 0;
+
+    while ((opt = getopt(ac, av, "m:n:v:f:o:S:t:s:")) != -1)
+        if (parse_option(opt, config) < 0)
+            return -1;
+    if (config->samples <= 0 || config->samples > MICRO_SAMPLES_MAX)
+        return -1;
+    return optind == ac && config->sample_ns > 0 ? 0 : -1;
+}
@@ -0,0 +1,50 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_micro: the measured functions
+*/
+
+#include "micro.h"
+#include "commands.h"
+#include <string.h>
+
+static player_t *pick_player(micro_world_t *world, unsigned long i)
+{
+    server_t *server = world->bench.server;
+
+    return server->players[i % server->player_nb];
+}
+
+void micro_look(micro_world_t *world, unsigned long i)
+{
+    char *response = build_look_response(world->bench.server,
+        pick_player(world, i));
+
+    mem_free(MEM_RESPONSES, response);
+}
+
+void micro_inventory(micro_world_t *world, unsigned long i)
+{
+    char *response = build_inventory_response(pick_player(world, i));
+
+    mem_free(MEM_RESPONSES, response);
+}
+
+void micro_count_players(micro_world_t *world, unsigned long i)
+{
+    map_t *map = world->bench.server->map;
+
+    count_players_on_tile(world->bench.server, i % map->width,
+        i / map->width % map->height);
+}
+
+/*
+** Commands publish events: the bus is flushed each time, as the loop
+** would, so it does not grow for the whole sample.
+*/
+void micro_eject(micro_world_t *world, unsigned long i)
+{
+    cmd_eject(world->bench.server, pick_player(world, i));
+    event_bus_flush(&world->bench.server->events);
+}
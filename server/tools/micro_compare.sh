@@ -0,0 +1,59 @@
+#!/bin/sh
+##
+## EPITECH PROJECT, 2025
+## zappy
+## File description:
+## compare two zappy_micro (or zappy_gui_micro) JSON runs
+##
+
+if [ $# -lt 2 ]; then
+    echo "USAGE: $0 baseline.json current.json [threshold_percent]" >&2
+    exit 84
+fi
+threshold=${3:-5}
+
+awk -v threshold="$threshold" '
+function field(line, key,    rest) {
+    rest = substr(line, index(line, "\"" key "\": ") + length(key) + 4)
+    sub(/^"/, "", rest)
+    sub(/[",}].*$/, "", rest)
+    return rest
+}
+FNR == 1 {
+    file++
+}
+/"id": / {
+    id = field($0, "id")
+    if (file == 1) {
+        base[id] = field($0, "ns_per_op")
+        order[++count] = id
+        next
+    }
+    current[id] = field($0, "ns_per_op")
+    if (!(id in base))
+        added[++extra] = id
+}
+END {
+    printf "%-40s %14s %14s %9s\n", "benchmark", "baseline ns", "current ns",
+        "delta"
+    for (i = 1; i <= count; i++) {
+        id = order[i]
+        if (!(id in current)) {
+            printf "%-40s %14.1f %14s %9s\n", id, base[id], "-", "missing"
+            continue
+        }
+        delta = (current[id] - base[id]) * 100 / base[id]
+        mark = delta > threshold ? "  slower" : delta < -threshold ? \
+            "  faster" : ""
+        printf "%-40s %14.1f %14.1f %+8.1f%%%s\n", id, base[id],
+            current[id], delta, mark
+        if (delta > threshold)
+            slower++
+    }
+    for (i = 1; i <= extra; i++)
+        printf "%-40s %14s %14.1f %9s\n", added[i], "-",
+            current[added[i]], "new"
+    printf "%d benchmark(s) slower than the baseline by more than %s%%\n",
+        slower, threshold
+    exit slower > 0
+}' "$1" "$2"
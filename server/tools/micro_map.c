@@ -0,0 +1,43 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_micro: broadcast, map-wide functions and the case table
+*/
+
+#include "micro.h"
+#include "commands.h"
+#include "gui.h"
+
+static void micro_broadcast(micro_world_t *world, unsigned long i)
+{
+    server_t *server = world->bench.server;
+    char message[] = "rally at the north-east corner";
+
+    cmd_broadcast(server, server->players[i % server->player_nb], message);
+    event_bus_flush(&server->events);
+}
+
+static void micro_generate(micro_world_t *world, unsigned long i)
+{
+    (void)i;
+    generate_resources(world->bench.server->map,
+        &world->bench.server->rng[RNG_RESPAWN]);
+}
+
+static void micro_map_content(micro_world_t *world, unsigned long i)
+{
+    (void)i;
+    send_map_content_to_gui(world->null_fd, world->bench.server->map);
+}
+
+const micro_case_t micro_cases[] = {
+    {"look", &micro_look, MICRO_MAP | MICRO_PLAYERS | MICRO_VISION},
+    {"inventory", &micro_inventory, 0},
+    {"count_players_on_tile", &micro_count_players, MICRO_PLAYERS},
+    {"eject", &micro_eject, MICRO_PLAYERS},
+    {"broadcast", &micro_broadcast, MICRO_MAP | MICRO_PLAYERS},
+    {"generate_resources", &micro_generate, MICRO_MAP},
+    {"send_map_content_to_gui", &micro_map_content, MICRO_MAP},
+    {NULL, NULL, 0}
+};
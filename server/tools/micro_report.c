@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_micro: text table and JSON output
+*/
+
+#include "micro.h"
+
+void micro_print(FILE *out, const micro_result_t *result)
+{
+    const bench_config_t *fixture = &result->fixture;
+
+    fprintf(out, "%-24s %4dx%-4d %4d players lvl %d %12.1f ns/op"
+        " (min %.1f, %lu/sample)\n", result->bench->name, fixture->width,
+        fixture->height, fixture->players, result->level,
+        result->ns_per_op, result->min_ns, result->iterations);
+}
+
+/*
+** One benchmark per line with a unique id, so tools/micro_compare.sh can
+** match a run against a baseline with nothing but awk.
+*/
+static void write_result(FILE *out, const micro_result_t *result,
+    const char *separator)
+{
+    const bench_config_t *fixture = &result->fixture;
+
+    fprintf(out, "  {\"id\": \"%s/%dx%d/p%d/v%d\", \"name\": \"%s\", "
+        "\"width\": %d, \"height\": %d, \"players\": %d, \"density\": %.4f,"
+        " \"level\": %d, \"ns_per_op\": %.2f, \"min_ns\": %.2f, "
+        "\"iterations\": %lu}%s\n", result->bench->name, fixture->width,
+        fixture->height, fixture->players, result->level,
+        result->bench->name, fixture->width, fixture->height,
+        fixture->players, (double)fixture->players / (fixture->width *
+        fixture->height), result->level, result->ns_per_op, result->min_ns,
+        result->iterations, separator);
+}
+
+int micro_write_json(const char *path, const micro_result_t *results,
+    int count)
+{
+    FILE *out = fopen(path, "w");
+
+    if (!out) {
+        perror(path);
+        return -1;
+    }
+    fprintf(out, "{\"suite\": \"zappy_micro\", \"benchmarks\": [\n");
+    for (int i = 0; i < count; i++)
+        write_result(out, &results[i], i + 1 < count ? "," : "");
+    fprintf(out, "]}\n");
+    return fclose(out);
+}
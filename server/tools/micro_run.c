@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_micro: calibration and timed samples
+*/
+
+#include "micro.h"
+
+static uint64_t run_batch(micro_world_t *world, micro_fn_t fn,
+    unsigned long iterations, unsigned long *counter)
+{
+    uint64_t start_ns = metrics_now_ns();
+
+    for (unsigned long i = 0; i < iterations; i++)
+        fn(world, (*counter)++);
+    return metrics_now_ns() - start_ns;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double left = *(const double *)a;
+    double right = *(const double *)b;
+
+    return (left > right) - (left < right);
+}
+
+/*
+** The batch size doubles until one batch fills a sample, so cheap and
+** expensive functions are both timed over the same wall-clock span.
+*/
+static unsigned long calibrate(const micro_config_t *config,
+    micro_world_t *world, micro_fn_t fn, unsigned long *counter)
+{
+    unsigned long iterations = 1;
+
+    while (run_batch(world, fn, iterations, counter) < config->sample_ns &&
+        iterations < (1UL << 30))
+        iterations *= 2;
+    return iterations;
+}
+
+static void measure(const micro_config_t *config, micro_world_t *world,
+    micro_result_t *result)
+{
+    double samples[MICRO_SAMPLES_MAX];
+    unsigned long counter = 0;
+    micro_fn_t fn = result->bench->fn;
+
+    result->iterations = calibrate(config, world, fn, &counter);
+    for (int s = 0; s < config->samples; s++)
+        samples[s] = (double)run_batch(world, fn, result->iterations,
+            &counter) / result->iterations;
+    qsort(samples, config->samples, sizeof(double), &compare_double);
+    result->ns_per_op = samples[config->samples / 2];
+    result->min_ns = samples[0];
+}
+
+int micro_run_case(const micro_config_t *config, micro_result_t *result)
+{
+    micro_world_t world = {0};
+
+    if (micro_world_init(&world, &result->fixture, result->level) < 0) {
+        micro_world_free(&world);
+        return -1;
+    }
+    measure(config, &world, result);
+    micro_world_free(&world);
+    return 0;
+}
@@ -0,0 +1,33 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_micro: one fixture, built fresh for every measurement
+*/
+
+#include "micro.h"
+#include <fcntl.h>
+#include <unistd.h>
+
+int micro_world_init(micro_world_t *world, const bench_config_t *fixture,
+    int level)
+{
+    server_t *server = NULL;
+
+    world->null_fd = -1;
+    if (bench_world_init(&world->bench, fixture) < 0)
+        return -1;
+    server = world->bench.server;
+    world->level = level;
+    for (int i = 0; i < server->player_nb; i++)
+        server->players[i]->lvl = level;
+    world->null_fd = open("/dev/null", O_WRONLY | O_CLOEXEC);
+    return world->null_fd < 0 ? -1 : 0;
+}
+
+void micro_world_free(micro_world_t *world)
+{
+    if (world->null_fd >= 0)
+        close(world->null_fd);
+    bench_world_free(&world->bench);
+}
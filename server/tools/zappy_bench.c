@@ -0,0 +1,72 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_bench: headless simulation throughput benchmark
+*/
+
+#include "bench.h"
+#include <string.h>
+#include <unistd.h>
+
+static int usage(const char *name)
+{
+    fprintf(stderr, "USAGE: %s [-x width] [-y height] [-n players]"
+        " [-t ticks] [-m mix] [-d depth] [-s seed]\n       mixes: ", name);
+    bench_mix_list(stderr);
+    return 84;
+}
+
+static int check_config(const bench_config_t *config)
+{
+    if (config->width <= 0 || config->height <= 0 || !config->mix)
+        return -1;
+    if (config->players <= 0 || config->players > MAX_PLAYERS)
+        return -1;
+    if (config->depth <= 0 || config->depth > BENCH_DEPTH_MAX)
+        return -1;
+    return config->ticks > 0 ? 0 : -1;
+}
+
+static int parse_bench(int ac, char **av, bench_config_t *config)
+{
+    int opt = 0;
+
+    while ((opt = getopt(ac, av, "x:y:n:t:m:d:s:")) != -1) {
+        if (opt == 'x')
+            config->width = atoi(optarg);
+        if (opt == 'y')
+            config->height = atoi(optarg);
+        if (opt == 'n')
+            config->players = atoi(optarg);
+        if (opt == 't')
+            config->ticks = strtoul(optarg, NULL, 10);
+        if (opt == 'd')
+            config->depth = atoi(optarg);
+        if (opt == 's')
+            config->seed = strtoull(optarg, NULL, 10);
+        if (opt == '?' || (opt == 'm' &&
+            !(config->mix = bench_mix_find(optarg))))
+            return -1;
+    }
+    return optind == ac ? check_config(config) : -1;
+}
+
+int main(int ac, char **av)
+{
+    bench_config_t config = {.width = 32, .height = 32, .players = 100,
+        .ticks = 2000, .depth = 2, .seed = 1,
+        .mix = bench_mix_find("default")};
+    bench_t bench = {0};
+
+    if (parse_bench(ac, av, &config) < 0)
+        return usage(av[0]);
+    if (bench_world_init(&bench, &config) < 0) {
+        fprintf(stderr, "zappy_bench: cannot build the world\n");
+        return 84;
+    }
+    bench_run(&bench, &config);
+    bench_report(&bench, &config);
+    bench_world_free(&bench);
+    return 0;
+}
@@ -0,0 +1,112 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_host: N independent worlds behind one port
+*/
+
+#include "host.h"
+#include <stdio.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <time.h>
+#include <unistd.h>
+
+static volatile sig_atomic_t stop_requested = 0;
+
+static void request_stop(int sig)
+{
+    (void)sig;
+    stop_requested = 1;
+}
+
+/*
+** -g and -T belong to the host; everything else is the usual server
+** command line, shared by every world.
+*/
+static int parse_host(int ac, char **av, host_t *host)
+{
+    for (int i = 1; i + 1 < ac; i++) {
+        if (strcmp(av[i], "-g") == 0)
+            host->world_nb = atoi(av[i + 1]);
+        if (strcmp(av[i], "-T") == 0)
+            host->worker_nb = atoi(av[i + 1]);
+    }
+    if (parse_args(ac, av, &host->base) < 0 || host->base.port <= 0 ||
+        host->base.nb_clients <= 0 || host->base.freq <= 0 ||
+        host->base.team_nb <= 0 || !host->base.teams)
+        return -1;
+    if (host->world_nb <= 0 || host->world_nb > HOST_GAMES_MAX)
+        return -1;
+    if (host->worker_nb <= 0 || host->worker_nb > HOST_WORKERS_MAX)
+        return -1;
+    if (!host->base.seeded)
+        host->base.seed = (uint64_t)time(NULL) ^ ((uint64_t)getpid() << 32);
+    host->base.seeded = true;
+    return 0;
+}
+
+static int start_host(host_t *host)
+{
+    struct sigaction action = {0};
+
+    action.sa_handler = &request_stop;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    signal(SIGPIPE, SIG_IGN);
+    host->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    host->worlds = calloc(host->world_nb, sizeof(host_world_t));
+    if (host->epoll_fd < 0 || !host->worlds)
+        return -1;
+    for (int i = 0; i < host->world_nb; i++)
+        if (host_world_init(host, &host->worlds[i], i) < 0)
+            return -1;
+    if (host_listen(host) < 0)
+        return -1;
+    log_info("Hosting %d worlds on port %d with %d workers",
+        host->world_nb, host->base.port, host->worker_nb);
+    return host_pool_start(host);
+}
+
+static void stop_host(host_t *host)
+{
+    if (host->workers)
+        host_pool_stop(host);
+    for (int i = 0; host->worlds && i < host->world_nb; i++)
+        host_world_free(&host->worlds[i]);
+    free(host->worlds);
+    for (int i = 0; host->base.teams && i < host->base.team_nb; i++)
+        free(host->base.teams[i].name);
+    free(host->base.teams);
+    free(host->base.team_name);
+    if (host->listen_fd > 0)
+        close(host->listen_fd);
+    if (host->epoll_fd > 0)
+        close(host->epoll_fd);
+    mem_report();
+    log_shutdown();
+}
+
+int main(int ac, char **av)
+{
+    host_t host = {.worker_nb = sysconf(_SC_NPROCESSORS_ONLN),
+        .world_nb = 1};
+    int status = 0;
+
+    if (host.worker_nb > HOST_WORKERS_MAX)
+        host.worker_nb = HOST_WORKERS_MAX;
+    if (parse_host(ac, av, &host) < 0) {
+        fprintf(stderr, "USAGE: %s -p port -x width -y height -n team1 ..."
+            " -c clientsNb -f freq [-g games] [-T threads] [-s seed]"
+            " [-l level] [-L log_file]\n", av[0]);
+        return 84;
+    }
+    if (log_init(host.base.log_level, host.base.log_path) < 0)
+        return 84;
+    status = start_host(&host);
+    if (status == 0)
+        host_reactor(&host, &stop_requested);
+    log_info("Host stopping");
+    stop_host(&host);
+    return status < 0 ? 84 : 0;
+}
@@ -0,0 +1,73 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_journal: query a game journal by player, tick range or type
+*/
+
+#include "journal_cli.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static int usage(const char *name)
+{
+    fprintf(stderr, "USAGE: %s journal [-p id] [-f from] [-u until]"
+        " [-e type,...] [-s] [-d]\n", name);
+    return 84;
+}
+
+static int parse_types(journal_query_t *query, char *list)
+{
+    int type = 0;
+
+    query->typed = true;
+    for (char *name = strtok(list, ","); name; name = strtok(NULL, ",")) {
+        for (type = 0; type < EVENT_TYPES &&
+            strcmp(event_name(type), name) != 0; type++);
+        if (type == EVENT_TYPES)
+            return -1;
+        query->types[type] = true;
+    }
+    return 0;
+}
+
+static int parse_query(int ac, char **av, journal_query_t *query)
+{
+    int opt = 0;
+
+    while ((opt = getopt(ac, av, "p:f:u:e:sd")) != -1) {
+        if (opt == 'p')
+            query->player = atoi(optarg);
+        if (opt == 'f')
+            query->from = strtoul(optarg, NULL, 10);
+        if (opt == 'u')
+            query->until = strtoul(optarg, NULL, 10);
+        if (opt == 's')
+            query->stats = true;
+        if (opt == 'd')
+            query->digests = true;
+        if (opt == '?' || (opt == 'e' && parse_types(query, optarg) < 0))
+            return -1;
+    }
+    return optind == ac - 1 ? 0 : -1;
+}
+
+int main(int ac, char **av)
+{
+    journal_query_t query = {.player = -1, .until = UINT32_MAX};
+    journal_file_t file = {0};
+
+    if (parse_query(ac, av, &query) < 0)
+        return usage(av[0]);
+    if (journal_file_open(&file, av[optind]) < 0)
+        return 84;
+    journal_query(&file, &query);
+    for (int type = 0; query.stats && type < EVENT_TYPES; type++)
+        if (query.counts[type])
+            printf("%s %lu\n", event_name(type), query.counts[type]);
+    if (query.stats)
+        printf("keyframes %lu\n", query.keyframes);
+    journal_file_close(&file);
+    return 0;
+}
@@ -0,0 +1,80 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** zappy_micro: per-function microbenchmarks of the server hot paths
+*/
+
+#include "micro.h"
+#include <string.h>
+
+/*
+** A case is swept only along the dimensions it depends on; the others
+** stay at index 0.
+*/
+static bool applies(const micro_case_t *bench, const int index[3])
+{
+    return (index[0] == 0 || bench->params & MICRO_MAP) &&
+        (index[1] == 0 || bench->params & MICRO_PLAYERS) &&
+        (index[2] == 0 || bench->params & MICRO_VISION);
+}
+
+static int run_one(const micro_config_t *config, const micro_case_t *bench,
+    const int index[3], micro_result_t *result)
+{
+    *result = (micro_result_t){.bench = bench,
+        .level = config->levels[index[2]]};
+    result->fixture = (bench_config_t){.width = config->widths[index[0]],
+        .height = config->heights[index[0]],
+        .players = config->players[index[1]], .seed = config->seed};
+    if (micro_run_case(config, result) < 0) {
+        fprintf(stderr, "zappy_micro: cannot build the %s fixture\n",
+            bench->name);
+        return -1;
+    }
+    micro_print(stdout, result);
+    fflush(stdout);
+    return 0;
+}
+
+static int run_case(const micro_config_t *config, const micro_case_t *bench,
+    micro_result_t **results, int *count)
+{
+    int index[3] = {0};
+    int total = config->size_nb * config->player_nb * config->level_nb;
+
+    for (int n = 0; n < total; n++) {
+        index[0] = n / (config->player_nb * config->level_nb);
+        index[1] = n / config->level_nb % config->player_nb;
+        index[2] = n % config->level_nb;
+        if (!applies(bench, index))
+            continue;
+        *results = realloc(*results, (*count + 1) * sizeof(micro_result_t));
+        if (!*results ||
+            run_one(config, bench, index, &(*results)[*count]) < 0)
+            return -1;
+        (*count)++;
+    }
+    return 0;
+}
+
+int main(int ac, char **av)
+{
+    micro_config_t config = {.widths = {10, 50, 100},
+        .heights = {10, 50, 100}, .size_nb = 3, .players = {10, 100},
+        .player_nb = 2, .levels = {1, 4, 8}, .level_nb = 3, .samples = 5,
+        .sample_ns = 20000000, .seed = 1};
+    micro_result_t *results = NULL;
+    int count = 0;
+    int status = 0;
+
+    if (micro_parse(ac, av, &config) < 0)
+        return micro_usage(av[0]);
+    for (int i = 0; status == 0 && micro_cases[i].name; i++)
+        if (!config.filter || strstr(micro_cases[i].name, config.filter))
+            status = run_case(&config, &micro_cases[i], &results, &count);
+    if (status == 0 && config.json_path)
+        status = micro_write_json(config.json_path, results, count);
+    free(results);
+    return status == 0 ? 0 : 84;
+}
@@ -0,0 +1,100 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** GuiMicro
+*/
+
+#include "GuiMicro.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+GuiMicro::GuiMicro(const Options &options)
+    : _options(options)
+{
+}
+
+long GuiMicro::runBatch(Op &op, unsigned long iterations,
+    unsigned long &counter) const
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned long i = 0; i < iterations; i++)
+        op(counter++);
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+GuiMicro::Result GuiMicro::measure(const Case &bench, const Fixture &fixture)
+{
+    GameState state;
+    Result result{bench.name, fixture};
+    std::vector<double> samples;
+    unsigned long counter = 0;
+    unsigned long iterations = 1;
+
+    fill(state, fixture);
+    Op op = bench.setup(state, fixture);
+    while (runBatch(op, iterations, counter) < _options.sampleNs
+        && iterations < (1UL << 30))
+        iterations *= 2;
+    for (int s = 0; s < _options.samples; s++)
+        samples.push_back(static_cast<double>(
+            runBatch(op, iterations, counter)) / iterations);
+    std::sort(samples.begin(), samples.end());
+    result.iterations = iterations;
+    result.nsPerOp = samples[samples.size() / 2];
+    result.minNs = samples.front();
+    return result;
+}
+
+void GuiMicro::run()
+{
+    for (const auto &bench : cases()) {
+        if (bench.name.find(_options.filter) == std::string::npos)
+            continue;
+        for (size_t s = 0; s < _options.sizes.size(); s++) {
+            for (size_t p = 0; p < _options.players.size(); p++) {
+                if ((s && !bench.usesMap) || (p && !bench.usesPlayers))
+                    continue;
+                _results.push_back(measure(bench, {_options.sizes[s].first,
+                    _options.sizes[s].second, _options.players[p]}));
+                const Result &r = _results.back();
+                std::cout << std::left << std::setw(24) << r.name
+                    << std::right << std::setw(5) << r.fixture.width << "x"
+                    << std::left << std::setw(4) << r.fixture.height
+                    << std::right << std::setw(5) << r.fixture.players
+                    << " players " << std::fixed << std::setprecision(1)
+                    << std::setw(12) << r.nsPerOp << " ns/op (min "
+                    << r.minNs << ", " << r.iterations << "/sample)"
+                    << std::endl;
+            }
+        }
+    }
+}
+
+bool GuiMicro::writeJson() const
+{
+    std::ofstream out(_options.output);
+
+    if (!out)
+        return false;
+    out << "{\"suite\": \"zappy_gui_micro\", \"benchmarks\": [\n"
+        << std::fixed << std::setprecision(2);
+    for (size_t i = 0; i < _results.size(); i++) {
+        const Result &r = _results[i];
+        out << "  {\"id\": \"" << r.name << "/" << r.fixture.width << "x"
+            << r.fixture.height << "/p" << r.fixture.players
+            << "/v1\", \"name\": \"" << r.name << "\", \"width\": "
+            << r.fixture.width << ", \"height\": " << r.fixture.height
+            << ", \"players\": " << r.fixture.players << ", \"ns_per_op\": "
+            << r.nsPerOp << ", \"min_ns\": " << r.minNs
+            << ", \"iterations\": " << r.iterations << "}"
+            << (i + 1 < _results.size() ? "," : "") << "\n";
+    }
+    out << "]}\n";
+    return static_cast<bool>(out);
+}
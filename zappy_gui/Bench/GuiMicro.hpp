@@ -0,0 +1,66 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** GuiMicro
+*/
+
+#ifndef GUIMICRO_HPP_
+    #define GUIMICRO_HPP_
+    #include "../Network/NetworkParser/NetworkParser.hpp"
+    #include "../Render/Game/GameState.hpp"
+    #include <chrono>
+    #include <functional>
+    #include <string>
+    #include <vector>
+
+/*
+** Client-side counterpart of the server's zappy_micro: same fixture
+** dimensions and the same one-line-per-benchmark JSON, so
+** server/tools/micro_compare.sh reads both.
+*/
+class GuiMicro {
+    public:
+        using Op = std::function<void(unsigned long)>;
+        struct Options {
+            std::vector<std::pair<int, int>> sizes = {{10, 10}, {50, 50},
+                {100, 100}};
+            std::vector<int> players = {10, 100};
+            std::string filter;
+            std::string output;
+            int samples = 5;
+            long sampleNs = 20000000;
+        };
+        struct Fixture {
+            int width;
+            int height;
+            int players;
+        };
+        struct Result {
+            std::string name;
+            Fixture fixture;
+            unsigned long iterations = 0;
+            double nsPerOp = 0;
+            double minNs = 0;
+        };
+        static bool parseArgs(int argc, char **argv, Options &options);
+        explicit GuiMicro(const Options &options);
+        void run();
+        bool writeJson() const;
+    private:
+        struct Case {
+            std::string name;
+            bool usesMap;
+            bool usesPlayers;
+            std::function<Op(GameState &, const Fixture &)> setup;
+        };
+        static std::vector<Case> cases();
+        static void fill(GameState &state, const Fixture &fixture);
+        Result measure(const Case &bench, const Fixture &fixture);
+        long runBatch(Op &op, unsigned long iterations,
+            unsigned long &counter) const;
+        Options _options;
+        std::vector<Result> _results;
+};
+
+#endif /* !GUIMICRO_HPP_ */
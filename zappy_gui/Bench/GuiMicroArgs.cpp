@@ -0,0 +1,75 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** GuiMicro command line
+*/
+
+#include "GuiMicro.hpp"
+#include <iostream>
+#include <sstream>
+
+static bool parseSizes(const std::string &arg,
+    std::vector<std::pair<int, int>> &sizes)
+{
+    std::istringstream list(arg);
+    std::string item;
+    int width;
+    int height;
+
+    sizes.clear();
+    while (std::getline(list, item, ',')) {
+        if (std::sscanf(item.c_str(), "%dx%d", &width, &height) != 2
+            || width <= 0 || height <= 0)
+            return false;
+        sizes.emplace_back(width, height);
+    }
+    return !sizes.empty();
+}
+
+static bool parseCounts(const std::string &arg, std::vector<int> &counts)
+{
+    std::istringstream list(arg);
+    std::string item;
+
+    counts.clear();
+    while (std::getline(list, item, ',')) {
+        counts.push_back(std::atoi(item.c_str()));
+        if (counts.back() <= 0)
+            return false;
+    }
+    return !counts.empty();
+}
+
+static bool parseOption(const std::string &flag, const std::string &value,
+    GuiMicro::Options &options)
+{
+    if (flag == "-m")
+        return parseSizes(value, options.sizes);
+    if (flag == "-n")
+        return parseCounts(value, options.players);
+    if (flag == "-f")
+        options.filter = value;
+    else if (flag == "-o")
+        options.output = value;
+    else if (flag == "-S")
+        options.samples = std::atoi(value.c_str());
+    else if (flag == "-t")
+        options.sampleNs = std::atol(value.c_str()) * 1000000;
+    else
+        return false;
+    return true;
+}
+
+bool GuiMicro::parseArgs(int argc, char **argv, Options &options)
+{
+    for (int i = 1; i < argc; i += 2) {
+        if (i + 1 >= argc || !parseOption(argv[i], argv[i + 1], options)) {
+            std::cerr << "Usage: ./zappy_gui_micro [-m WxH,...]"
+                " [-n players,...] [-f filter] [-o results.json]"
+                " [-S samples] [-t ms_per_sample]" << std::endl;
+            return false;
+        }
+    }
+    return options.samples > 0 && options.sampleNs > 0;
+}
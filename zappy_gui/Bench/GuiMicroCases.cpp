@@ -0,0 +1,97 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** GuiMicro fixtures and measured operations
+*/
+
+#include "GuiMicro.hpp"
+#include "../Render/ResourceLayout.hpp"
+#include <memory>
+#include <random>
+
+static std::string bctLine(int x, int y, std::mt19937 &rng)
+{
+    std::string line = "bct " + std::to_string(x) + " " + std::to_string(y);
+
+    for (int r = 0; r < 7; r++)
+        line += " " + std::to_string(rng() % 4);
+    return line;
+}
+
+/*
+** The state a spectator holds after the resync header: map size, every
+** tile and every player.
+*/
+void GuiMicro::fill(GameState &state, const Fixture &fixture)
+{
+    NetworkParser parser;
+    std::mt19937 rng(1);
+
+    parser.parse("msz " + std::to_string(fixture.width) + " "
+        + std::to_string(fixture.height), state);
+    parser.parse("tna red", state);
+    for (int y = 0; y < fixture.height; y++)
+        for (int x = 0; x < fixture.width; x++)
+            parser.parse(bctLine(x, y, rng), state);
+    for (int i = 0; i < fixture.players; i++)
+        parser.parse("pnw " + std::to_string(i) + " "
+            + std::to_string(rng() % fixture.width) + " "
+            + std::to_string(rng() % fixture.height) + " 1 1 red", state);
+}
+
+static GuiMicro::Op parseMap(GameState &state, const GuiMicro::Fixture &f)
+{
+    auto parser = std::make_shared<NetworkParser>();
+    auto lines = std::make_shared<std::vector<std::string>>();
+    std::mt19937 rng(2);
+
+    for (int y = 0; y < f.height; y++)
+        for (int x = 0; x < f.width; x++)
+            lines->push_back(bctLine(x, y, rng));
+    return [parser, lines, &state](unsigned long) {
+        for (const auto &line : *lines)
+            parser->parse(line, state);
+    };
+}
+
+static GuiMicro::Op parsePlayers(GameState &state,
+    const GuiMicro::Fixture &f)
+{
+    auto parser = std::make_shared<NetworkParser>();
+    auto lines = std::make_shared<std::vector<std::string>>();
+
+    for (int i = 0; i < f.players; i++) {
+        lines->push_back("ppo " + std::to_string(i) + " "
+            + std::to_string(i % f.width) + " 0 2");
+        lines->push_back("pin " + std::to_string(i) + " "
+            + std::to_string(i % f.width) + " 0 9 1 0 0 0 0 0");
+    }
+    return [parser, lines, &state](unsigned long i) {
+        parser->parse((*lines)[i % lines->size()], state);
+    };
+}
+
+/*
+** The SFML-free half of Render::drawResources: the map copy and the
+** sprite placement for every resource, at zoom 1 with the map at the
+** origin.
+*/
+static GuiMicro::Op layoutResourcesCase(GameState &state,
+    const GuiMicro::Fixture &)
+{
+    auto sprites = std::make_shared<std::vector<ResourceSprite>>();
+
+    return [&state, sprites](unsigned long) {
+        layoutResources(state.map, {0.0f, 0.0f, 1.0f}, *sprites);
+    };
+}
+
+std::vector<GuiMicro::Case> GuiMicro::cases()
+{
+    return {
+        {"parse_bct_map", true, false, parseMap},
+        {"parse_player_updates", false, true, parsePlayers},
+        {"layout_resources", true, false, layoutResourcesCase},
+    };
+}
@@ -0,0 +1,23 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** GuiMicro main
+*/
+#include <iostream>
+#include "GuiMicro.hpp"
+
+int main(int argc, char** argv)
+{
+    GuiMicro::Options options;
+
+    if (!GuiMicro::parseArgs(argc, argv, options))
+        return 84;
+    GuiMicro micro(options);
+    micro.run();
+    if (!options.output.empty() && !micro.writeJson()) {
+        std::cerr << "Error: cannot write " << options.output << std::endl;
+        return 84;
+    }
+    return 0;
+}
@@ -6,6 +6,7 @@
 */
 
 #include "GuiCore.hpp"
+#include "../Network/RegionSync/RegionSync.hpp"
 #include <string>
 #include <iostream>
 #include <cstring>
@@ -23,7 +24,10 @@ void GuiCore::run()
     while (_running && _render->isOpen()) {
         _render->handleEvents();
         processNetworkMsg();
+        processSharedWorld();
         updateGameState();
+        syncViewport();
+        checkRegions();
         _render->render(_gameState);
     }
     _network->stopReceive();
@@ -34,8 +38,23 @@ void GuiCore::processNetworkMsg()
     std::string msg;
 
     while (_network->tryPopMessage(msg)) {
+        if (_sharedWorld.isOpen() && SharedWorld::isRingEvent(msg))
+            continue;
         _parser.parse(msg, _gameState);
     }
+    _parser.checkResync(_gameState);
+}
+
+void GuiCore::processSharedWorld()
+{
+    std::vector<std::string> lines;
+
+    if (!_sharedWorld.isOpen())
+        return;
+    _sharedWorld.readSnapshot(_gameState);
+    _sharedWorld.pollEvents(lines);
+    for (const auto &line : lines)
+        _parser.parse(line, _gameState);
 }
 
 void GuiCore::updateGameState()
@@ -45,6 +64,44 @@ void GuiCore::updateGameState()
     }
 }
 
+void GuiCore::syncViewport()
+{
+    Viewport view = _render->getViewport(_gameState);
+
+    if (_sharedWorld.isOpen()) {
+        if (_subscribedView.width == 0) {
+            _subscribedView = {0, 0, 1, 1};
+            _network->sendMessage("vsub 0 0 1 1 0\n");
+        }
+        return;
+    }
+    if (_gameState.map.getWidth() == 0 || view.width == 0 || view.height == 0)
+        return;
+    Viewport covered = _subscribedView;
+    covered.x -= VIEW_MARGIN / 2;
+    covered.y -= VIEW_MARGIN / 2;
+    covered.width += VIEW_MARGIN;
+    covered.height += VIEW_MARGIN;
+    if (_subscribedView.width != 0 && covered.contains(view) &&
+        view.width >= _subscribedView.width && view.height >= _subscribedView.height)
+        return;
+    _subscribedView = view;
+    _network->sendMessage("vsub " + std::to_string(view.x) + " " + std::to_string(view.y) + " " +
+        std::to_string(view.width) + " " + std::to_string(view.height) + " " +
+        std::to_string(VIEW_MARGIN) + "\n");
+}
+
+void GuiCore::checkRegions()
+{
+    auto now = std::chrono::steady_clock::now();
+
+    if (_sharedWorld.isOpen() || _gameState.regionSize <= 0 || now - _lastRegionCheck < REGION_CHECK_INTERVAL)
+        return;
+    _lastRegionCheck = now;
+    for (const auto &line : RegionSync::buildRequests(_gameState, _subscribedView))
+        _network->sendMessage(line);
+}
+
 void GuiCore::startNetworkReceive()
 {
     _network->startReceive();
@@ -55,12 +112,29 @@ bool GuiCore::tryPopMessage(std::string& msg)
     return _network->tryPopMessage(msg);
 }
 
-bool GuiCore::parseArgs(int argc, char** argv, int& port, std::string& hostname)
+bool GuiCore::attachSharedWorld(const std::string &name)
+{
+    if (!_sharedWorld.open(name)) {
+        std::cerr << "Cannot map shared world " << name << ", using the network stream" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool GuiCore::parseArgs(int argc, char** argv, int& port, std::string& hostname,
+    std::string &shmName)
 {
-    if (argc != 5) {
-        std::cerr << "Usage: ./zappy_gui -p <port> -h <hostname>" << std::endl;
+    if (argc != 5 && argc != 7) {
+        std::cerr << "Usage: ./zappy_gui -p <port> -h <hostname> [-m <shm name>]" << std::endl;
         return false;
     }
+    if (argc == 7) {
+        if (std::strcmp(argv[5], "-m") != 0) {
+            std::cerr << "Invalid argument use: -m <shm name>" << std::endl;
+            return false;
+        }
+        shmName = argv[6];
+    }
     if (std::strcmp(argv[1], "-p") != 0 || std::strcmp(argv[3], "-h") != 0) {
         std::cerr << "Invalid argument use: -p <port> -h <host>" << std::endl;
         return false;
@@ -8,10 +8,12 @@
 #ifndef GUICORE_HPP_
     #define GUICORE_HPP_
     #include <memory>
+    #include <chrono>
     #include "../Network/INetwork.hpp"
     #include "../Render/IRender.hpp"
     #include "../Network/NetworkClient/NetworkClient.hpp"
     #include "../Network/NetworkParser/NetworkParser.hpp"
+    #include "../Network/SharedWorld/SharedWorld.hpp"
     #include "../Render/Game/GameState.hpp"
 
 class GuiCore {
@@ -20,16 +22,26 @@ class GuiCore {
         ~GuiCore() = default;
         void run();
         void processNetworkMsg();
+        void processSharedWorld();
         void updateGameState();
+        void syncViewport();
+        void checkRegions();
+        bool attachSharedWorld(const std::string &name);
         void startNetworkReceive();
         bool tryPopMessage(std::string &msg);
-        static bool parseArgs(int argc, char **argv, int &port, std::string& hostname);
+        static bool parseArgs(int argc, char **argv, int &port, std::string& hostname,
+            std::string &shmName);
     private:
         std::unique_ptr<INetwork> _network;
         std::unique_ptr<IRender> _render;
         NetworkParser _parser;
         GameState _gameState;
+        SharedWorld _sharedWorld;
         bool _running;
+        Viewport _subscribedView;
+        static constexpr int VIEW_MARGIN = 4;
+        std::chrono::steady_clock::time_point _lastRegionCheck = std::chrono::steady_clock::now();
+        static constexpr std::chrono::seconds REGION_CHECK_INTERVAL{5};
 };
 
 #endif /* !GUICORE_HPP_ */
@@ -95,12 +95,14 @@ void NetworkClient::receiveMessage()
     ssize_t bytesRead = recv(_socket, _buffer, sizeof(_buffer) - 1, 0);
     if (bytesRead == 0) {
         _running = false;
+        _closed = true;
         return;
     }
     if (bytesRead < 0) {
         if (errno != EAGAIN && errno != EWOULDBLOCK) {
             perror("recv");
             _running = false;
+            _closed = true;
         }
         return;
     }
@@ -133,3 +135,13 @@ bool NetworkClient::tryPopMessage(std::string &msg)
     return true;
 }
 
+
+int NetworkClient::getSocket() const
+{
+    return _socket;
+}
+
+bool NetworkClient::isClosed() const
+{
+    return _closed;
+}
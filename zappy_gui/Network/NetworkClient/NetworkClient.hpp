@@ -32,6 +32,8 @@ class NetworkClient : public INetwork {
         void stopReceive() override;
         void networkLoop();
         bool tryPopMessage(std::string &msg) override;
+        int getSocket() const;
+        bool isClosed() const;
     private:
         int _socket;
         sockaddr_in _serverAddr{};
@@ -42,6 +44,7 @@ class NetworkClient : public INetwork {
         std::atomic<bool> _running;
         std::mutex _queueMutex;
         bool _startMsg = false;
+        std::atomic<bool> _closed{false};
 };
 
 #endif /* !NETWORKCLIENT_HPP_ */
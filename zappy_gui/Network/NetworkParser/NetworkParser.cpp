@@ -6,9 +6,12 @@
 */
 
 #include "NetworkParser.hpp"
+#include "../RegionSync/RegionSync.hpp"
 #include <sstream>
 #include <algorithm>
 #include <array>
+#include <cctype>
+#include <cstdlib>
 
 static const std::string resourceNames[] = {
     "food", "linemate", "deraumere", "sibur", "mendiane", "phiras", "thystame"
@@ -30,6 +33,8 @@ void NetworkParser::parse_msz(const std::string &message, GameState &gameState)
     iss >> msz;
     int width, height;
     iss >> width >> height;
+    if (width == gameState.map.getWidth() && height == gameState.map.getHeight())
+        return;
     gameState.map.resize(width, height);
 }
 
@@ -54,7 +59,9 @@ void NetworkParser::parse_tna(const std::string &message, GameState &gameState)
     std::string tna;
     std::string team_name;
     iss >> tna >> team_name;
-    if (!team_name.empty())
+    if (team_name.empty())
+        return;
+    if (std::find(gameState.teams.begin(), gameState.teams.end(), team_name) == gameState.teams.end())
         gameState.teams.push_back(team_name);
 }
 
@@ -68,7 +75,9 @@ void NetworkParser::parse_pnw(const std::string &message, GameState &gameState)
     if (team_name.empty()) {
         return;
     }
-    gameState.players.push_back(Player(id, team_name));
+    if (std::none_of(gameState.players.begin(), gameState.players.end(),
+        [id](const Player &player) { return player.getId() == id; }))
+        gameState.players.push_back(Player(id, team_name));
     for (auto &player : gameState.players) {
         if (player.getId() == id) {
             player.setPosition(x, y, direction);
@@ -177,7 +186,8 @@ void NetworkParser::parse_pfk(const std::string &message, GameState &gameState)
     for (auto &player : gameState.players) {
         if (player.getId() == id) {
             addPopMessage("Egg laying by the player " + std::to_string(id), gameState);
-            gameState.eggs.push_back(Egg(gameState.eggs.back().getId() + 1, id, player.getX(), player.getY()));
+            int eggId = gameState.eggs.empty() ? 0 : gameState.eggs.back().getId() + 1;
+            gameState.eggs.push_back(Egg(eggId, id, player.getX(), player.getY()));
         }
     }
 }
@@ -188,15 +198,11 @@ void NetworkParser::parse_enw(const std::string &message, GameState &gameState)
     std::string enw;
     int eggId, playerId, x, y;
     iss >> enw >> eggId >> playerId >> x >> y;
+    if (std::any_of(gameState.eggs.begin(), gameState.eggs.end(),
+        [eggId](const Egg &egg) { return egg.getId() == eggId; }))
+        return;
     gameState.eggs.push_back(Egg(eggId, playerId, x, y));
-    
-    for (auto &player : gameState.players) {
-        if (player.getId() == gameState.eggs.back().getPlayerId()) {
-            addPopMessage("Egg laying by the player " + std::to_string(gameState.eggs.back().getPlayerId()), gameState);
-            gameState.eggs.push_back(Egg(eggId, playerId, x, y));
-        }
-    }
-    parse_pfk("pfk " + std::to_string(playerId) + "\n", gameState);
+    addPopMessage("Egg laying by the player " + std::to_string(playerId), gameState);
 }
 
 void NetworkParser::parse_ebo(const std::string &message, GameState &gameState)
@@ -328,6 +334,76 @@ void NetworkParser::parse_pie(const std::string &message, GameState &gameState)
     }
 }
 
+void NetworkParser::parse_rgs(const std::string &message, GameState &gameState)
+{
+    std::istringstream iss(message);
+    std::string rgs;
+    int size = 0;
+    iss >> rgs >> size;
+    gameState.regionSize = size;
+}
+
+void NetworkParser::parse_rbg(const std::string &message, GameState &gameState)
+{
+    std::istringstream iss(message);
+    std::string rbg;
+    int region = -1;
+    iss >> rbg >> region;
+    if (gameState.regionSize <= 0 || region < 0)
+        return;
+    _inResync = true;
+    gameState.players.erase(std::remove_if(gameState.players.begin(), gameState.players.end(),
+        [&gameState, region](const Player &player) {
+            return RegionSync::regionOf(gameState, player.getX(), player.getY()) == region;
+        }), gameState.players.end());
+}
+
+void NetworkParser::parse_vex(const std::string &message, GameState &gameState)
+{
+    std::istringstream iss(message);
+    std::string vex;
+    int x = 0, y = 0, width = 0, height = 0;
+    iss >> vex >> x >> y >> width >> height;
+    gameState.players.erase(std::remove_if(gameState.players.begin(), gameState.players.end(),
+        [x, y, width, height](const Player &player) {
+            return player.getX() >= x && player.getX() < x + width &&
+                player.getY() >= y && player.getY() < y + height;
+        }), gameState.players.end());
+}
+
+void NetworkParser::parse_ren(const std::string &message, GameState &)
+{
+    std::istringstream iss(message);
+    std::string ren;
+    int region = -1;
+    std::string hash;
+    char *end = nullptr;
+    iss >> ren >> region >> hash;
+    _inResync = false;
+    if (region < 0 || hash.empty() || !std::isxdigit(static_cast<unsigned char>(hash[0])))
+        return;
+    uint64_t expected = std::strtoull(hash.c_str(), &end, 16);
+    if (*end != '\0')
+        return;
+    _pendingRen.emplace_back(region, expected);
+}
+
+/*
+** A resync burst is a run of rbg ... ren groups: the regions it closed are
+** only checked once the burst is over, against a single hash pass.
+*/
+void NetworkParser::checkResync(GameState &gameState)
+{
+    if (_pendingRen.empty())
+        return;
+    std::vector<uint64_t> hashes = RegionSync::computeHashes(gameState);
+    for (const auto &[region, expected] : _pendingRen) {
+        if (region < static_cast<int>(hashes.size()) && hashes[region] != expected)
+            std::cerr << "Region " << region << " still out of sync after resync" << std::endl;
+    }
+    _pendingRen.clear();
+}
+
 void NetworkParser::parse(const std::string &msg, GameState &gameState)
 {
     std::istringstream iss(msg);
@@ -358,9 +434,15 @@ void NetworkParser::parse(const std::string &msg, GameState &gameState)
         {"suc", &NetworkParser::parse_suc},
         {"sbp", &NetworkParser::parse_sbp},
         {"pic", &NetworkParser::parse_pic},
-        {"pie", &NetworkParser::parse_pie}
+        {"pie", &NetworkParser::parse_pie},
+        {"rgs", &NetworkParser::parse_rgs},
+        {"rbg", &NetworkParser::parse_rbg},
+        {"ren", &NetworkParser::parse_ren},
+        {"vex", &NetworkParser::parse_vex}
     };
 
+    if (!_inResync && command != "rbg")
+        checkResync(gameState);
     auto it = cmd.find(command);
     if (it != cmd.end()) {
         (this->*(it->second))(msg, gameState);
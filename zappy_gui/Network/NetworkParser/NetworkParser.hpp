@@ -18,6 +18,9 @@
     #include <functional>
     #include <iostream>
     #include <deque>
+    #include <cstdint>
+    #include <utility>
+    #include <vector>
 
 class NetworkParser : public INetworkParser {
     public:
@@ -47,8 +50,15 @@ class NetworkParser : public INetworkParser {
         void parse_sbp(const std::string &msg, GameState &gameState);
         void parse_pic(const std::string &msg, GameState &gameState);
         void parse_pie(const std::string &msg, GameState &gameState);
+        void parse_rgs(const std::string &msg, GameState &gameState);
+        void parse_rbg(const std::string &msg, GameState &gameState);
+        void parse_ren(const std::string &msg, GameState &gameState);
+        void parse_vex(const std::string &msg, GameState &gameState);
+        void checkResync(GameState &gameState);
     private :
         void addPopMessage(const std::string& msg, GameState &gameState);
+        std::vector<std::pair<int, uint64_t>> _pendingRen;
+        bool _inResync = false;
 };
 
 #endif /* !NETWORKPARSER_HPP_ */
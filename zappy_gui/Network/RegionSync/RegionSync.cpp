@@ -0,0 +1,106 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** RegionSync
+*/
+
+#include "RegionSync.hpp"
+#include <cstdio>
+
+uint64_t RegionSync::mix(uint64_t value)
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+uint64_t RegionSync::hashTile(int x, int y, const std::array<int, 7> &resources)
+{
+    uint64_t hash = mix(TILE_SEED ^ static_cast<uint32_t>(x));
+
+    hash = mix(hash ^ static_cast<uint32_t>(y));
+    for (int res : resources)
+        hash = mix(hash ^ static_cast<uint32_t>(res));
+    return hash;
+}
+
+uint64_t RegionSync::hashPlayer(const Player &player)
+{
+    const int fields[5] = {player.getId(), player.getX(), player.getY(),
+        player.getDirection(), player.getLevel()};
+    uint64_t hash = PLAYER_SEED;
+
+    for (int field : fields)
+        hash = mix(hash ^ static_cast<uint32_t>(field));
+    for (int res : player.getInventory())
+        hash = mix(hash ^ static_cast<uint32_t>(res));
+    return hash;
+}
+
+int RegionSync::regionCount(const GameState &gameState)
+{
+    int size = gameState.regionSize;
+
+    if (size <= 0)
+        return 0;
+    return ((gameState.map.getWidth() + size - 1) / size) *
+        ((gameState.map.getHeight() + size - 1) / size);
+}
+
+int RegionSync::regionOf(const GameState &gameState, int x, int y)
+{
+    int size = gameState.regionSize;
+    int cols = (gameState.map.getWidth() + size - 1) / size;
+
+    return (y / size) * cols + x / size;
+}
+
+std::vector<uint64_t> RegionSync::computeHashes(GameState &gameState)
+{
+    std::vector<uint64_t> hashes(regionCount(gameState), 0);
+
+    if (hashes.empty())
+        return hashes;
+    for (int y = 0; y < gameState.map.getHeight(); y++) {
+        for (int x = 0; x < gameState.map.getWidth(); x++)
+            hashes[regionOf(gameState, x, y)] ^= hashTile(x, y, gameState.map.at(x, y).getResources());
+    }
+    for (const auto &player : gameState.players) {
+        if (player.getX() < 0 || player.getX() >= gameState.map.getWidth() ||
+            player.getY() < 0 || player.getY() >= gameState.map.getHeight())
+            continue;
+        hashes[regionOf(gameState, player.getX(), player.getY())] ^= hashPlayer(player);
+    }
+    return hashes;
+}
+
+std::vector<std::string> RegionSync::buildRequests(GameState &gameState, const Viewport &view)
+{
+    std::vector<uint64_t> hashes = computeHashes(gameState);
+    std::vector<std::string> lines;
+    std::string line;
+    size_t pairs = 0;
+    char pair[48];
+
+    for (size_t region = 0; region < hashes.size(); region++) {
+        int size = gameState.regionSize;
+        int cols = (gameState.map.getWidth() + size - 1) / size;
+        Viewport area{static_cast<int>(region % cols) * size, static_cast<int>(region / cols) * size, size, size};
+        if (view.width > 0 && (area.x >= view.x + view.width || area.x + area.width <= view.x ||
+            area.y >= view.y + view.height || area.y + area.height <= view.y))
+            continue;
+        std::snprintf(pair, sizeof(pair), " %zu %016llx", region, static_cast<unsigned long long>(hashes[region]));
+        line += pair;
+        if (++pairs % PAIRS_PER_LINE == 0) {
+            lines.push_back("rsh" + line + "\n");
+            line.clear();
+        }
+    }
+    if (!line.empty())
+        lines.push_back("rsh" + line + "\n");
+    return lines;
+}
@@ -0,0 +1,31 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** RegionSync
+*/
+
+#ifndef REGIONSYNC_HPP_
+    #define REGIONSYNC_HPP_
+    #include <cstdint>
+    #include <string>
+    #include <vector>
+    #include "../../Render/Game/GameState.hpp"
+    #include "../../Render/Viewport.hpp"
+
+class RegionSync {
+    public:
+        static uint64_t hashTile(int x, int y, const std::array<int, 7> &resources);
+        static uint64_t hashPlayer(const Player &player);
+        static int regionCount(const GameState &gameState);
+        static int regionOf(const GameState &gameState, int x, int y);
+        static std::vector<uint64_t> computeHashes(GameState &gameState);
+        static std::vector<std::string> buildRequests(GameState &gameState, const Viewport &view);
+    private:
+        static uint64_t mix(uint64_t value);
+        static constexpr uint64_t TILE_SEED = 0x54494c45ULL;
+        static constexpr uint64_t PLAYER_SEED = 0x504c4159ULL;
+        static constexpr size_t PAIRS_PER_LINE = 32;
+};
+
+#endif /* !REGIONSYNC_HPP_ */
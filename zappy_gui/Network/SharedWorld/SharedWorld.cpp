@@ -0,0 +1,160 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** SharedWorld
+*/
+
+#include "SharedWorld.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_set>
+
+SharedWorld::~SharedWorld()
+{
+    if (_base)
+        munmap(_base, _size);
+}
+
+bool SharedWorld::open(const std::string &name)
+{
+    struct stat st;
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+
+    if (fd < 0)
+        return false;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(shm_world_header_t)) {
+        close(fd);
+        return false;
+    }
+    _size = st.st_size;
+    _base = mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (_base == MAP_FAILED) {
+        _base = nullptr;
+        return false;
+    }
+    auto *header = static_cast<const shm_world_header_t *>(_base);
+    if (header->magic != SHM_WORLD_MAGIC || header->version != SHM_WORLD_VERSION
+        || shm_world_size(header->width, header->height) > _size) {
+        munmap(_base, _size);
+        _base = nullptr;
+        return false;
+    }
+    _eventTail = __atomic_load_n(&header->event_head, __ATOMIC_ACQUIRE);
+    return true;
+}
+
+bool SharedWorld::isOpen() const
+{
+    return _base != nullptr;
+}
+
+/*
+** Commands the server also writes to the event ring (EVENT_TO_SHM in
+** server/src/event_format.c): a mapped GUI takes them from there only.
+*/
+bool SharedWorld::isRingEvent(const std::string &msg)
+{
+    static const std::unordered_set<std::string> ring = {
+        "pnw", "plv", "pex", "pbc", "pic", "pie", "pfk", "pdr", "pgt", "pdi", "sst"
+    };
+
+    return ring.count(msg.substr(0, msg.find(' '))) > 0;
+}
+
+bool SharedWorld::copyFrame()
+{
+    auto *header = static_cast<shm_world_header_t *>(_base);
+    size_t cells = (size_t)header->width * header->height;
+
+    _players.resize(SHM_PLAYER_SLOTS);
+    _planes.resize(cells * SHM_RESOURCES);
+    for (int attempt = 0; attempt < MAX_RETRIES; attempt++) {
+        uint32_t seq = __atomic_load_n(&header->seq, __ATOMIC_ACQUIRE);
+        if (seq & 1)
+            continue;
+        if (seq == _lastSeq && attempt == 0 && _header.magic)
+            return false;
+        std::memcpy(&_header, header, sizeof(_header));
+        std::memcpy(_players.data(), shm_world_players(_base),
+            sizeof(shm_world_player_t) * SHM_PLAYER_SLOTS);
+        std::memcpy(_planes.data(), shm_world_plane(_base, 0),
+            sizeof(int32_t) * _planes.size());
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&header->seq, __ATOMIC_RELAXED) == seq) {
+            _lastSeq = seq;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SharedWorld::readSnapshot(GameState &gameState)
+{
+    if (!_base || !copyFrame())
+        return false;
+    applyFrame(gameState);
+    return true;
+}
+
+void SharedWorld::applyFrame(GameState &gameState) const
+{
+    int width = _header.width;
+    int height = _header.height;
+
+    if (gameState.map.getWidth() != width || gameState.map.getHeight() != height)
+        gameState.map.resize(width, height);
+    gameState.timeUnit = _header.freq;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            std::array<int, 7> resources;
+            for (int i = 0; i < SHM_RESOURCES; i++)
+                resources[i] = _planes[(size_t)i * width * height + y * width + x];
+            gameState.map.at(x, y).setResources(resources);
+        }
+    }
+    std::vector<Player> players;
+    for (const auto &slot : _players) {
+        if (!slot.active)
+            continue;
+        Player player(slot.id, std::string(slot.team, strnlen(slot.team, SHM_TEAM_SIZE)));
+        player.setPosition(slot.x, slot.y, slot.dir);
+        player.setLevel(slot.lvl);
+        player.setInventory({slot.inventory[0], slot.inventory[1], slot.inventory[2],
+            slot.inventory[3], slot.inventory[4], slot.inventory[5], slot.inventory[6]});
+        players.push_back(player);
+    }
+    gameState.players = std::move(players);
+}
+
+void SharedWorld::pollEvents(std::vector<std::string> &lines)
+{
+    if (!_base)
+        return;
+    auto *header = static_cast<shm_world_header_t *>(_base);
+    shm_world_event_t *events = shm_world_events(_base);
+    uint64_t head = __atomic_load_n(&header->event_head, __ATOMIC_ACQUIRE);
+
+    if (head - _eventTail > SHM_EVENT_SLOTS)
+        _eventTail = head - SHM_EVENT_SLOTS;
+    for (; _eventTail < head; _eventTail++) {
+        shm_world_event_t *slot = &events[_eventTail % SHM_EVENT_SLOTS];
+        if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != _eventTail + 1)
+            continue;
+        char line[SHM_EVENT_SIZE];
+        std::memcpy(line, slot->line, sizeof(line));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) != _eventTail + 1)
+            continue;
+        line[SHM_EVENT_SIZE - 1] = '\0';
+        std::string text(line);
+        if (!text.empty() && text.back() == '\n')
+            text.pop_back();
+        lines.push_back(text);
+    }
+}
@@ -0,0 +1,39 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** SharedWorld
+*/
+
+#ifndef SHAREDWORLD_HPP_
+    #define SHAREDWORLD_HPP_
+    #include "../../../server/include/shm_world.h"
+    #include "../../Render/Game/GameState.hpp"
+    #include <string>
+    #include <vector>
+
+class SharedWorld {
+    public:
+        SharedWorld() = default;
+        ~SharedWorld();
+        SharedWorld(const SharedWorld &) = delete;
+        SharedWorld &operator=(const SharedWorld &) = delete;
+        bool open(const std::string &name);
+        bool isOpen() const;
+        bool readSnapshot(GameState &gameState);
+        void pollEvents(std::vector<std::string> &lines);
+        static bool isRingEvent(const std::string &msg);
+    private:
+        bool copyFrame();
+        void applyFrame(GameState &gameState) const;
+        void *_base = nullptr;
+        size_t _size = 0;
+        uint32_t _lastSeq = 0;
+        uint64_t _eventTail = 0;
+        shm_world_header_t _header{};
+        std::vector<shm_world_player_t> _players;
+        std::vector<int32_t> _planes;
+        static constexpr int MAX_RETRIES = 64;
+};
+
+#endif /* !SHAREDWORLD_HPP_ */
@@ -0,0 +1,212 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Relay
+*/
+
+#include "Relay.hpp"
+#include "Snapshot.hpp"
+#include <algorithm>
+#include <cstring>
+#include <netinet/in.h>
+#include <stdexcept>
+
+Relay::Relay(const std::string &host, int port, int listenPort)
+    : _upstream(host, port)
+{
+    openListener(listenPort);
+}
+
+Relay::~Relay()
+{
+    for (auto &client : _clients)
+        close(client.fd);
+    if (_listenFd != -1)
+        close(_listenFd);
+}
+
+bool Relay::parseArgs(int argc, char **argv, int &port,
+    std::string &hostname, int &listenPort)
+{
+    if (argc != 7 || std::strcmp(argv[1], "-p") != 0
+        || std::strcmp(argv[3], "-h") != 0 || std::strcmp(argv[5], "-l") != 0) {
+        std::cerr << "Usage: ./zappy_relay -p <port> -h <hostname> -l <listen port>"
+            << std::endl;
+        return false;
+    }
+    port = std::atoi(argv[2]);
+    hostname = argv[4];
+    listenPort = std::atoi(argv[6]);
+    if (port <= 0 || listenPort <= 0 || hostname.empty()) {
+        std::cerr << "Invalid port number or hostname" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void Relay::openListener(int listenPort)
+{
+    sockaddr_in addr{};
+    int opt = 1;
+
+    _listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (_listenFd < 0)
+        throw std::runtime_error("Failed to create relay socket");
+    setsockopt(_listenFd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = INADDR_ANY;
+    addr.sin_port = htons(listenPort);
+    if (bind(_listenFd, (sockaddr *)&addr, sizeof(addr)) < 0
+        || listen(_listenFd, SOMAXCONN) < 0)
+        throw std::runtime_error("Failed to listen on relay port");
+    fcntl(_listenFd, F_SETFL, O_NONBLOCK);
+}
+
+std::vector<pollfd> Relay::buildPollSet() const
+{
+    std::vector<pollfd> fds;
+
+    fds.push_back({_upstream.getSocket(), POLLIN, 0});
+    fds.push_back({_listenFd, POLLIN, 0});
+    for (const auto &client : _clients) {
+        short events = POLLIN;
+        if (!client.out.empty())
+            events |= POLLOUT;
+        fds.push_back({client.fd, events, 0});
+    }
+    return fds;
+}
+
+void Relay::run()
+{
+    while (!_upstream.isClosed()) {
+        std::vector<pollfd> fds = buildPollSet();
+        if (poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("poll");
+            return;
+        }
+        if (fds[0].revents)
+            handleUpstream();
+        for (size_t i = 2; i < fds.size(); i++) {
+            if (fds[i].revents & (POLLIN | POLLHUP | POLLERR))
+                readClient(_clients[i - 2]);
+        }
+        if (fds[1].revents & POLLIN)
+            acceptClient();
+        for (auto &client : _clients)
+            flushClient(client);
+        dropClosed();
+    }
+    std::cerr << "Upstream server closed the connection" << std::endl;
+}
+
+void Relay::acceptClient()
+{
+    int fd;
+
+    while ((fd = accept(_listenFd, nullptr, nullptr)) >= 0) {
+        fcntl(fd, F_SETFL, O_NONBLOCK);
+        _clients.push_back({fd});
+        queue(_clients.back(), "WELCOME\n");
+    }
+}
+
+void Relay::readClient(Downstream &client)
+{
+    char buffer[1024];
+    ssize_t bytesRead = recv(client.fd, buffer, sizeof(buffer), 0);
+    size_t pos;
+
+    if (bytesRead <= 0) {
+        if (bytesRead == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+            client.closed = true;
+        return;
+    }
+    client.in.append(buffer, bytesRead);
+    while ((pos = client.in.find('\n')) != std::string::npos) {
+        std::string line = client.in.substr(0, pos);
+        client.in.erase(0, pos + 1);
+        if (line.empty())
+            continue;
+        if (client.live) {
+            queue(client, Snapshot::answer(_mirror, line));
+            continue;
+        }
+        if (line.rfind("GRAPHIC", 0) != 0) {
+            client.closed = true;
+            return;
+        }
+        queue(client, Snapshot::encode(_mirror));
+        client.live = true;
+    }
+}
+
+void Relay::queue(Downstream &client, const std::string &data)
+{
+    if (client.closed)
+        return;
+    client.out += data;
+    if (client.out.size() > MAX_BACKLOG) {
+        std::cerr << "Dropping spectator that fell too far behind" << std::endl;
+        client.closed = true;
+    }
+}
+
+void Relay::flushClient(Downstream &client)
+{
+    ssize_t sent;
+
+    if (client.closed || client.out.empty())
+        return;
+    sent = send(client.fd, client.out.data(), client.out.size(), MSG_NOSIGNAL);
+    if (sent < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+            client.closed = true;
+        return;
+    }
+    client.out.erase(0, sent);
+}
+
+void Relay::dropClosed()
+{
+    auto it = std::remove_if(_clients.begin(), _clients.end(),
+        [](const Downstream &client) {
+            if (client.closed)
+                close(client.fd);
+            return client.closed;
+        });
+    _clients.erase(it, _clients.end());
+}
+
+bool Relay::isPerConnection(const std::string &line)
+{
+    static const std::string commands[] = {"rgs", "rbg", "ren", "suc", "sbp"};
+    std::string command = line.substr(0, line.find(' '));
+
+    return std::find(std::begin(commands), std::end(commands), command)
+        != std::end(commands);
+}
+
+void Relay::handleUpstream()
+{
+    std::string msg;
+
+    _upstream.receiveMessage();
+    while (_upstream.tryPopMessage(msg)) {
+        _parser.parse(msg, _mirror);
+        if (!isPerConnection(msg))
+            broadcast(msg + "\n");
+    }
+    _mirror._popMessages.clear();
+}
+
+void Relay::broadcast(const std::string &line)
+{
+    for (auto &client : _clients) {
+        if (client.live)
+            queue(client, line);
+    }
+}
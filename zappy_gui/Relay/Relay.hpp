@@ -0,0 +1,50 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Relay
+*/
+
+#ifndef RELAY_HPP_
+    #define RELAY_HPP_
+    #include "../Network/NetworkClient/NetworkClient.hpp"
+    #include "../Network/NetworkParser/NetworkParser.hpp"
+    #include "../Render/Game/GameState.hpp"
+    #include <poll.h>
+    #include <string>
+    #include <vector>
+
+class Relay {
+    public:
+        Relay(const std::string &host, int port, int listenPort);
+        ~Relay();
+        static bool parseArgs(int argc, char **argv, int &port,
+            std::string &hostname, int &listenPort);
+        void run();
+    private:
+        struct Downstream {
+            int fd;
+            bool live = false;
+            bool closed = false;
+            std::string in;
+            std::string out;
+        };
+        void openListener(int listenPort);
+        void acceptClient();
+        void readClient(Downstream &client);
+        void flushClient(Downstream &client);
+        void queue(Downstream &client, const std::string &data);
+        void handleUpstream();
+        void broadcast(const std::string &line);
+        void dropClosed();
+        std::vector<pollfd> buildPollSet() const;
+        static bool isPerConnection(const std::string &line);
+        NetworkClient _upstream;
+        NetworkParser _parser;
+        GameState _mirror;
+        int _listenFd = -1;
+        std::vector<Downstream> _clients;
+        static constexpr size_t MAX_BACKLOG = 8 * 1024 * 1024;
+};
+
+#endif /* !RELAY_HPP_ */
@@ -0,0 +1,110 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Snapshot
+*/
+
+#include "Snapshot.hpp"
+#include <sstream>
+
+static std::string joinResources(const std::array<int, 7> &resources)
+{
+    std::string out;
+
+    for (int quantity : resources)
+        out += " " + std::to_string(quantity);
+    return out;
+}
+
+std::string Snapshot::encode(GameState &gameState)
+{
+    std::string out;
+
+    out += "msz " + std::to_string(gameState.map.getWidth()) + " "
+        + std::to_string(gameState.map.getHeight()) + "\n";
+    out += "sgt " + std::to_string(gameState.timeUnit) + "\n";
+    encodeMap(out, gameState);
+    encodeTeams(out, gameState);
+    encodePlayers(out, gameState);
+    encodeEggs(out, gameState);
+    return out;
+}
+
+/*
+** Spectators are read-only: the map queries are answered from the mirror,
+** everything else gets suc like an unknown command on the server.
+*/
+std::string Snapshot::answer(GameState &gameState, const std::string &line)
+{
+    std::istringstream iss(line);
+    std::string command;
+    std::string out;
+    int x = -1;
+    int y = -1;
+
+    iss >> command;
+    if (command == "msz")
+        return "msz " + std::to_string(gameState.map.getWidth()) + " "
+            + std::to_string(gameState.map.getHeight()) + "\n";
+    if (command == "sgt")
+        return "sgt " + std::to_string(gameState.timeUnit) + "\n";
+    if (command == "bct") {
+        if (!(iss >> x >> y) || x < 0 || y < 0 || x >= gameState.map.getWidth()
+            || y >= gameState.map.getHeight())
+            return "sbp\n";
+        return encodeTile(gameState, x, y);
+    }
+    if (command == "mct")
+        encodeMap(out, gameState);
+    else if (command == "tna")
+        encodeTeams(out, gameState);
+    else
+        out = "suc\n";
+    return out;
+}
+
+std::string Snapshot::encodeTile(GameState &gameState, int x, int y)
+{
+    return "bct " + std::to_string(x) + " " + std::to_string(y)
+        + joinResources(gameState.map.at(x, y).getResources()) + "\n";
+}
+
+void Snapshot::encodeMap(std::string &out, GameState &gameState)
+{
+    for (int y = 0; y < gameState.map.getHeight(); y++) {
+        for (int x = 0; x < gameState.map.getWidth(); x++)
+            out += encodeTile(gameState, x, y);
+    }
+}
+
+void Snapshot::encodeTeams(std::string &out, GameState &gameState)
+{
+    for (const auto &team : gameState.teams)
+        out += "tna " + team + "\n";
+}
+
+void Snapshot::encodePlayers(std::string &out, GameState &gameState)
+{
+    for (const auto &player : gameState.players) {
+        std::string id = std::to_string(player.getId());
+        std::string pos = std::to_string(player.getX()) + " "
+            + std::to_string(player.getY());
+
+        out += "pnw " + id + " " + pos + " "
+            + std::to_string(player.getDirection()) + " "
+            + std::to_string(player.getLevel()) + " " + player.getTeam() + "\n";
+        out += "pin " + id + " " + pos
+            + joinResources(player.getInventory()) + "\n";
+    }
+}
+
+void Snapshot::encodeEggs(std::string &out, GameState &gameState)
+{
+    for (const auto &egg : gameState.eggs) {
+        out += "enw " + std::to_string(egg.getId()) + " "
+            + std::to_string(egg.getPlayerId()) + " "
+            + std::to_string(egg.getX()) + " "
+            + std::to_string(egg.getY()) + "\n";
+    }
+}
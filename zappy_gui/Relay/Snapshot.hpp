@@ -0,0 +1,25 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Snapshot
+*/
+
+#ifndef SNAPSHOT_HPP_
+    #define SNAPSHOT_HPP_
+    #include "../Render/Game/GameState.hpp"
+    #include <string>
+
+class Snapshot {
+    public:
+        static std::string encode(GameState &gameState);
+        static std::string answer(GameState &gameState, const std::string &line);
+    private:
+        static std::string encodeTile(GameState &gameState, int x, int y);
+        static void encodeMap(std::string &out, GameState &gameState);
+        static void encodeTeams(std::string &out, GameState &gameState);
+        static void encodePlayers(std::string &out, GameState &gameState);
+        static void encodeEggs(std::string &out, GameState &gameState);
+};
+
+#endif /* !SNAPSHOT_HPP_ */
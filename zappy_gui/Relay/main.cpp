@@ -0,0 +1,27 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Relay main
+*/
+#include <iostream>
+#include "Relay.hpp"
+
+int main(int argc, char** argv)
+{
+    int port;
+    int listenPort;
+    std::string hostname;
+
+    if (!Relay::parseArgs(argc, argv, port, hostname, listenPort)) {
+        return 84;
+    }
+    try {
+        Relay relay(hostname, port, listenPort);
+        relay.run();
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 84;
+    }
+    return 0;
+}
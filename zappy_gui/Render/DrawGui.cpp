@@ -257,44 +257,23 @@ void Render::drawResources(const GameState &gameState) {
         {6 * 16, 2 * 16, 16, 16}  //thystame
     };
 
-    float offsets[7][2] = {
-        {0.5f, 0.1f},
-        {0.85f, 0.15f},
-        {0.9f, 0.5f},
-        {0.85f, 0.85f},
-        {0.5f, 0.9f},
-        {0.15f, 0.85f},
-        {0.1f, 0.5f}
-    };
-
     float tileWidth = 64.0f * _zoom;
     float tileHeight = 64.0f * _zoom;
     float mapWidthPx = gameState.map.getWidth() * tileWidth;
     float mapHeightPx = gameState.map.getHeight() * tileHeight;
-    float originX = (_window->getSize().x - mapWidthPx) / 2.0f + _isoOffsetX;
-    float originY = (_window->getSize().y - mapHeightPx) / 2.0f + _isoOffsetY;
-    Map _cpy = gameState.map;
+    ResourceFrame frame = {
+        (_window->getSize().x - mapWidthPx) / 2.0f + _isoOffsetX,
+        (_window->getSize().y - mapHeightPx) / 2.0f + _isoOffsetY,
+        _zoom
+    };
+    sf::Sprite sprite(_resourcesTexture);
 
-    for (int j = 0; j < gameState.map.getHeight(); j++) {
-        for (int i = 0; i < gameState.map.getWidth(); i++) {
-            const auto& resources = _cpy.at(i, j).getResources();
-            if (resources.empty())
-                continue;
-            int resCount = std::min((int)resources.size(), 7);
-            for (int r = 0; r < resCount; ++r) {
-                if (resources[r] > 0) {
-                    sf::Sprite sprite(_resourcesTexture);
-                    sprite.setTextureRect(spriteRects[r]);
-                    sprite.setScale(tileWidth / 64.0f, tileHeight / 64.0f);
-
-                    float posX = originX + i * tileWidth + offsets[r][0] * tileWidth - 8 * _zoom;
-                    float posY = originY + j * tileHeight + offsets[r][1] * tileHeight - 8 * _zoom;
-
-                    sprite.setPosition(posX, posY);
-                    _window->draw(sprite);
-                }
-            }
-        }
+    layoutResources(gameState.map, frame, _resourceSprites);
+    sprite.setScale(tileWidth / 64.0f, tileHeight / 64.0f);
+    for (const auto &placed : _resourceSprites) {
+        sprite.setTextureRect(spriteRects[placed.type]);
+        sprite.setPosition(placed.x, placed.y);
+        _window->draw(sprite);
     }
 }
 
@@ -20,6 +20,7 @@ struct GameState {
     std::vector<Egg> eggs;
     std::vector<std::string> teams;
     int timeUnit = 0;
+    int regionSize = 0;
     bool endGame = false;
     std::string winnerTeam;
     std::mutex mutex;
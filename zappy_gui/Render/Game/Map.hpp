@@ -17,8 +17,8 @@ class Map {
         int getWidth() const;
         int getHeight() const;
     private:
-        int _width;
-        int _height;
+        int _width = 0;
+        int _height = 0;
         std::vector<std::vector<Tile>> _tiles;
 };
 
@@ -9,7 +9,6 @@
     #define PLAYER_HPP
     #include <array>
     #include <string>
-    #include <SFML/System/Clock.hpp>
 
 class Player {
     public:
@@ -9,6 +9,7 @@
 #define IRENDER_HPP_
 
 #include "Game/GameState.hpp"
+#include "Viewport.hpp"
 
 class IRender {
     public:
@@ -18,6 +19,7 @@ class IRender {
         virtual bool isOpen() const = 0;
         virtual void handleEvents() = 0;
         virtual void close() = 0;
+        virtual Viewport getViewport(const GameState &gameState) const = 0;
 };
 
 #endif /* !IRENDER_HPP_ */
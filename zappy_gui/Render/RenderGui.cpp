@@ -6,6 +6,8 @@
 */
 
 #include "RenderGui.hpp"
+#include <algorithm>
+#include <cmath>
 
 Render::Render() = default;
 
@@ -82,6 +84,28 @@ void Render::handleEvents() {
     }
 }
 
+Viewport Render::getViewport(const GameState &gameState) const {
+    Viewport view;
+    if (!_window)
+        return view;
+    float tileWidth = 64.0f * _zoom;
+    float tileHeight = 64.0f * _zoom;
+    int mapWidth = gameState.map.getWidth();
+    int mapHeight = gameState.map.getHeight();
+    float originX = (_window->getSize().x - mapWidth * tileWidth) / 2.f + _isoOffsetX;
+    float originY = (_window->getSize().y - mapHeight * tileHeight) / 2.f + _isoOffsetY;
+
+    int left = std::max(0, static_cast<int>(std::floor(-originX / tileWidth)));
+    int top = std::max(0, static_cast<int>(std::floor(-originY / tileHeight)));
+    int right = std::min(mapWidth, static_cast<int>(std::ceil((_window->getSize().x - originX) / tileWidth)));
+    int bottom = std::min(mapHeight, static_cast<int>(std::ceil((_window->getSize().y - originY) / tileHeight)));
+    view.x = left;
+    view.y = top;
+    view.width = std::max(0, right - left);
+    view.height = std::max(0, bottom - top);
+    return view;
+}
+
 void Render::close() {
     if (_window && _window->isOpen())
         _window->close();
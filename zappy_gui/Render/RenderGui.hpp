@@ -18,6 +18,7 @@
 #include "Game/Player.hpp"
 #include "Game/Egg.hpp"
 #include "Game/GameState.hpp"
+#include "ResourceLayout.hpp"
 
 class Render : public IRender {
     public:
@@ -29,6 +30,7 @@ class Render : public IRender {
         bool isOpen() const override;
         void handleEvents() override;
         void close() override;
+        Viewport getViewport(const GameState &gameState) const override;
 
     private:
         std::unique_ptr<sf::RenderWindow> _window;
@@ -39,6 +41,7 @@ class Render : public IRender {
         bool menu, endGame;
         float _isoOffsetX = 0.f, _isoOffsetY = 0.f;
         float _zoom = 1.f;
+        std::vector<ResourceSprite> _resourceSprites;
 
         void drawMenu();
         void drawEndGame(const GameState &gameState);
@@ -0,0 +1,40 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** ResourceLayout.cpp
+*/
+
+#include "ResourceLayout.hpp"
+#include <algorithm>
+
+void layoutResources(const Map &map, const ResourceFrame &frame,
+    std::vector<ResourceSprite> &sprites)
+{
+    static const float offsets[7][2] = {
+        {0.5f, 0.1f},
+        {0.85f, 0.15f},
+        {0.9f, 0.5f},
+        {0.85f, 0.85f},
+        {0.5f, 0.9f},
+        {0.15f, 0.85f},
+        {0.1f, 0.5f}
+    };
+    float tileSize = 64.0f * frame.zoom;
+    Map _cpy = map;
+
+    sprites.clear();
+    for (int j = 0; j < _cpy.getHeight(); j++) {
+        for (int i = 0; i < _cpy.getWidth(); i++) {
+            const auto &resources = _cpy.at(i, j).getResources();
+            int resCount = std::min((int)resources.size(), 7);
+            for (int r = 0; r < resCount; ++r) {
+                if (resources[r] <= 0)
+                    continue;
+                sprites.push_back({r,
+                    frame.originX + i * tileSize + offsets[r][0] * tileSize - 8 * frame.zoom,
+                    frame.originY + j * tileSize + offsets[r][1] * tileSize - 8 * frame.zoom});
+            }
+        }
+    }
+}
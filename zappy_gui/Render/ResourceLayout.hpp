@@ -0,0 +1,32 @@
+/*
+** EPITECH PROJECT, 2025
+** zappy
+** File description:
+** ResourceLayout.hpp
+*/
+
+#ifndef RESOURCE_LAYOUT_HPP
+    #define RESOURCE_LAYOUT_HPP
+    #include "Game/Map.hpp"
+    #include <vector>
+
+struct ResourceSprite {
+    int type;
+    float x;
+    float y;
+};
+
+struct ResourceFrame {
+    float originX;
+    float originY;
+    float zoom;
+};
+
+/*
+** Where Render::drawResources places one sprite per resource present on
+** a tile. Kept free of SFML so zappy_gui_micro can time it.
+*/
+void layoutResources(const Map &map, const ResourceFrame &frame,
+    std::vector<ResourceSprite> &sprites);
+
+#endif /* !RESOURCE_LAYOUT_HPP */
@@ -0,0 +1,30 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Viewport
+*/
+
+#ifndef VIEWPORT_HPP_
+    #define VIEWPORT_HPP_
+
+struct Viewport {
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+
+    bool contains(const Viewport &other) const
+    {
+        return other.x >= x && other.y >= y &&
+            other.x + other.width <= x + width &&
+            other.y + other.height <= y + height;
+    }
+    bool operator==(const Viewport &other) const
+    {
+        return x == other.x && y == other.y &&
+            width == other.width && height == other.height;
+    }
+};
+
+#endif /* !VIEWPORT_HPP_ */
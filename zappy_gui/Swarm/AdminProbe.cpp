@@ -0,0 +1,96 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Samples the server tick counter over its admin socket
+*/
+
+#include "AdminProbe.hpp"
+#include <cstring>
+#include <sstream>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+AdminProbe::AdminProbe(const std::string &path)
+    : _path(path)
+{
+}
+
+AdminProbe::~AdminProbe()
+{
+    if (_fd != -1)
+        close(_fd);
+}
+
+bool AdminProbe::enabled() const
+{
+    return !_path.empty();
+}
+
+void AdminProbe::start(int epollFd, uint64_t tag)
+{
+    sockaddr_un addr{};
+    epoll_event event{};
+
+    if (!enabled() || _fd != -1)
+        return;
+    event.events = EPOLLIN | EPOLLRDHUP;
+    event.data.u64 = tag;
+    _fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, _path.c_str(), sizeof(addr.sun_path) - 1);
+    if (_fd < 0 || connect(_fd, (sockaddr *)&addr, sizeof(addr)) < 0
+        || write(_fd, "status\n", 7) != 7
+        || epoll_ctl(epollFd, EPOLL_CTL_ADD, _fd, &event) < 0) {
+        if (_fd != -1)
+            close(_fd);
+        _fd = -1;
+    }
+    _reply.clear();
+}
+
+void AdminProbe::onReadable(Clock::time_point now)
+{
+    char buffer[512];
+    ssize_t len;
+
+    while ((len = read(_fd, buffer, sizeof(buffer))) > 0)
+        _reply.append(buffer, len);
+    if (len == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+        finish(now);
+}
+
+void AdminProbe::finish(Clock::time_point now)
+{
+    std::istringstream lines(_reply);
+    std::string key;
+    uint64_t tick = 0;
+    double elapsed;
+
+    close(_fd);
+    _fd = -1;
+    while (lines >> key) {
+        if (key == "tick")
+            lines >> tick;
+        else if (key == "freq")
+            lines >> _freq;
+    }
+    elapsed = std::chrono::duration<double>(now - _lastAt).count();
+    if (_hasLast && elapsed > 0)
+        _ticksPerSec = (tick - _lastTick) / elapsed;
+    _lastTick = tick;
+    _lastAt = now;
+    _hasLast = tick > 0 || _reply.find("tick") != std::string::npos;
+}
+
+double AdminProbe::ticksPerSec() const
+{
+    return _ticksPerSec;
+}
+
+int AdminProbe::freq() const
+{
+    return _freq;
+}
@@ -0,0 +1,41 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Samples the server tick counter over its admin socket
+*/
+
+#ifndef ADMINPROBE_HPP_
+    #define ADMINPROBE_HPP_
+    #include <chrono>
+    #include <cstdint>
+    #include <string>
+
+/*
+** One "status" request per sample, driven by the swarm's epoll loop:
+** the admin socket answers once the server loop gets to it, so a slow
+** answer is itself a symptom of overload.
+*/
+class AdminProbe {
+    public:
+        using Clock = std::chrono::steady_clock;
+        explicit AdminProbe(const std::string &path);
+        ~AdminProbe();
+        bool enabled() const;
+        void start(int epollFd, uint64_t tag);
+        void onReadable(Clock::time_point now);
+        double ticksPerSec() const;
+        int freq() const;
+    private:
+        void finish(Clock::time_point now);
+        std::string _path;
+        int _fd = -1;
+        std::string _reply;
+        uint64_t _lastTick = 0;
+        Clock::time_point _lastAt;
+        bool _hasLast = false;
+        double _ticksPerSec = -1;
+        int _freq = 0;
+};
+
+#endif /* !ADMINPROBE_HPP_ */
@@ -0,0 +1,86 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** One scripted AI connection of the swarm
+*/
+
+#include "Bot.hpp"
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+Bot::Bot(const std::string &team, int game)
+    : _team(team), _game(game)
+{
+}
+
+/*
+** Edge-triggered on both directions: every wake-up drains the socket and
+** the output buffer, so no EPOLL_CTL_MOD is ever needed.
+*/
+bool Bot::open(const sockaddr_in &addr, int epollFd, uint64_t tag)
+{
+    epoll_event event{};
+
+    _fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    if (_fd < 0)
+        return false;
+    event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+    event.data.u64 = tag;
+    if ((connect(_fd, (const sockaddr *)&addr, sizeof(addr)) < 0
+        && errno != EINPROGRESS)
+        || epoll_ctl(epollFd, EPOLL_CTL_ADD, _fd, &event) < 0) {
+        close();
+        return false;
+    }
+    _state = State::Connecting;
+    if (_game >= 0)
+        _out = "GAME " + std::to_string(_game) + "\n";
+    return true;
+}
+
+void Bot::close()
+{
+    if (_fd != -1)
+        ::close(_fd);
+    _fd = -1;
+    _state = State::Closed;
+    _pending.clear();
+}
+
+void Bot::onEvent(uint32_t events, Context &context, Clock::time_point now)
+{
+    int error = 0;
+    socklen_t len = sizeof(error);
+
+    if (_state == State::Connecting) {
+        getsockopt(_fd, SOL_SOCKET, SO_ERROR, &error, &len);
+        if (error != 0 || (events & EPOLLERR)) {
+            context.stats.refused++;
+            close();
+            return;
+        }
+        _state = State::Joining;
+    }
+    if (!readAll(context, now) || (events & (EPOLLHUP | EPOLLRDHUP))) {
+        if (_state == State::Playing)
+            context.stats.dropped++;
+        else if (_state != State::Closed)
+            context.stats.refused++;
+        close();
+        return;
+    }
+    pump(context, now);
+    flush();
+}
+
+Bot::State Bot::state() const
+{
+    return _state;
+}
+
+size_t Bot::inFlight() const
+{
+    return _pending.size();
+}
@@ -0,0 +1,55 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** One scripted AI connection of the swarm
+*/
+
+#ifndef BOT_HPP_
+    #define BOT_HPP_
+    #include "Mix.hpp"
+    #include "Stats.hpp"
+    #include <chrono>
+    #include <deque>
+    #include <netinet/in.h>
+    #include <random>
+    #include <string>
+
+class Bot {
+    public:
+        using Clock = std::chrono::steady_clock;
+        enum class State { Idle, Connecting, Joining, Playing, Closed };
+        struct Context {
+            const Mix &mix;
+            size_t depth;
+            std::mt19937 &rng;
+            Stats &stats;
+        };
+        Bot(const std::string &team, int game);
+        bool open(const sockaddr_in &addr, int epollFd, uint64_t tag);
+        void onEvent(uint32_t events, Context &context, Clock::time_point now);
+        void close();
+        State state() const;
+        size_t inFlight() const;
+    private:
+        struct Pending {
+            size_t command;
+            Clock::time_point sent;
+        };
+        bool readAll(Context &context, Clock::time_point now);
+        void handleLine(const std::string &line, Context &context,
+            Clock::time_point now);
+        void handleJoin(const std::string &line, Context &context);
+        void pump(Context &context, Clock::time_point now);
+        void flush();
+        int _fd = -1;
+        State _state = State::Idle;
+        std::string _team;
+        int _game;
+        int _joinLines = 0;
+        std::string _in;
+        std::string _out;
+        std::deque<Pending> _pending;
+};
+
+#endif /* !BOT_HPP_ */
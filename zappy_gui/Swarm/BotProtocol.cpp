@@ -0,0 +1,97 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Swarm bot: join handshake, pipelining and reply matching
+*/
+
+#include "Bot.hpp"
+#include <sys/socket.h>
+
+bool Bot::readAll(Context &context, Clock::time_point now)
+{
+    char buffer[4096];
+    ssize_t len;
+    size_t pos;
+
+    while ((len = recv(_fd, buffer, sizeof(buffer), 0)) > 0) {
+        _in.append(buffer, len);
+        while ((pos = _in.find('\n')) != std::string::npos
+            && _state != State::Closed) {
+            handleLine(_in.substr(0, pos), context, now);
+            _in.erase(0, pos + 1);
+        }
+    }
+    if (_state == State::Closed)
+        return true;
+    return len < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+}
+
+/*
+** WELCOME, then the free slot count (or "ko" when the team is full), then
+** the map size.
+*/
+void Bot::handleJoin(const std::string &line, Context &context)
+{
+    if (line == "ko") {
+        context.stats.refused++;
+        close();
+        return;
+    }
+    _joinLines++;
+    if (line == "WELCOME")
+        _out += _team + "\n";
+    if (_joinLines == 3) {
+        _state = State::Playing;
+        context.stats.joined++;
+    }
+}
+
+/*
+** Replies come back in order; broadcasts and ejections are the only
+** unsolicited lines a scripted bot can receive.
+*/
+void Bot::handleLine(const std::string &line, Context &context,
+    Clock::time_point now)
+{
+    const std::string *command;
+
+    if (_state != State::Playing)
+        return handleJoin(line, context);
+    if (line == "dead") {
+        context.stats.dead++;
+        close();
+        return;
+    }
+    if (line.rfind("message ", 0) == 0 || line.rfind("eject: ", 0) == 0
+        || _pending.empty())
+        return;
+    command = &context.mix.commands[_pending.front().command];
+    context.stats.record(command->substr(0, command->find(' ')),
+        std::chrono::duration_cast<std::chrono::microseconds>(
+        now - _pending.front().sent).count());
+    _pending.pop_front();
+}
+
+void Bot::pump(Context &context, Clock::time_point now)
+{
+    size_t command;
+
+    while (_state == State::Playing && _pending.size() < context.depth) {
+        command = context.rng() % context.mix.commands.size();
+        _out += context.mix.commands[command] + "\n";
+        _pending.push_back({command, now});
+    }
+}
+
+void Bot::flush()
+{
+    ssize_t sent;
+
+    while (_fd != -1 && !_out.empty()) {
+        sent = send(_fd, _out.data(), _out.size(), MSG_NOSIGNAL);
+        if (sent <= 0)
+            return;
+        _out.erase(0, sent);
+    }
+}
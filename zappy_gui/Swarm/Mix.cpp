@@ -0,0 +1,42 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Swarm command mixes
+*/
+
+#include "Mix.hpp"
+
+static const std::vector<Mix> mixes = {
+    {"default", {"Forward", "Forward", "Right", "Left", "Look",
+        "Inventory", "Take food", "Set linemate", "Take linemate",
+        "Broadcast hello"}},
+    {"look", {"Look", "Look", "Look", "Look", "Look", "Look", "Forward",
+        "Right", "Left", "Inventory"}},
+    {"broadcast", {"Broadcast rally at the north-east corner",
+        "Broadcast rally at the north-east corner", "Broadcast hello",
+        "Broadcast hello", "Broadcast hello", "Broadcast hello",
+        "Forward", "Right", "Look"}},
+    {"fork", {"Fork", "Fork", "Fork", "Fork", "Fork", "Fork", "Forward",
+        "Right", "Inventory"}},
+    {"eject", {"Eject", "Eject", "Eject", "Forward", "Left", "Look",
+        "Take food"}},
+    {"light", {"Inventory", "Right", "Left", "Connect_nbr"}},
+};
+
+const Mix *Mix::find(const std::string &name)
+{
+    for (const auto &mix : mixes)
+        if (mix.name == name)
+            return &mix;
+    return nullptr;
+}
+
+std::string Mix::list()
+{
+    std::string names;
+
+    for (const auto &mix : mixes)
+        names += (names.empty() ? "" : ", ") + mix.name;
+    return names;
+}
@@ -0,0 +1,25 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Swarm command mixes
+*/
+
+#ifndef MIX_HPP_
+    #define MIX_HPP_
+    #include <string>
+    #include <vector>
+
+/*
+** Same mixes as zappy_bench, so a swarm run and a bench run on the same
+** mix stress the same code paths with and without the network.
+*/
+struct Mix {
+    std::string name;
+    std::vector<std::string> commands;
+
+    static const Mix *find(const std::string &name);
+    static std::string list();
+};
+
+#endif /* !MIX_HPP_ */
@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Swarm latency and tick-rate statistics
+*/
+
+#include "Stats.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
+
+void Stats::record(const std::string &command, uint32_t micros)
+{
+    _latency[command].push_back(micros);
+    _interval.push_back(micros);
+}
+
+Stats::Summary Stats::summarize(std::vector<uint32_t> samples)
+{
+    Summary summary;
+    auto rank = [&samples](double q) {
+        return samples[std::min(samples.size() - 1,
+            static_cast<size_t>(q * samples.size()))];
+    };
+
+    if (samples.empty())
+        return summary;
+    std::sort(samples.begin(), samples.end());
+    summary.count = samples.size();
+    summary.mean = std::accumulate(samples.begin(), samples.end(), 0.0)
+        / samples.size();
+    summary.p50 = rank(0.50);
+    summary.p90 = rank(0.90);
+    summary.p99 = rank(0.99);
+    summary.p999 = rank(0.999);
+    summary.max = samples.back();
+    return summary;
+}
+
+Stats::Sample Stats::closeInterval(double second, double elapsed)
+{
+    Summary summary = summarize(std::move(_interval));
+    Sample sample;
+
+    _interval.clear();
+    sample.second = second;
+    sample.responsesPerSec = elapsed > 0 ? summary.count / elapsed : 0;
+    sample.p50 = summary.p50;
+    sample.p99 = summary.p99;
+    return sample;
+}
+
+void Stats::addSample(const Sample &sample)
+{
+    _timeline.push_back(sample);
+}
+
+void Stats::print(std::ostream &out) const
+{
+    out << "bots joined " << joined << ", refused " << refused
+        << ", dead " << dead << ", dropped " << dropped << std::endl;
+    out << std::left << std::setw(12) << "command" << std::right
+        << std::setw(10) << "count" << std::setw(10) << "p50_us"
+        << std::setw(10) << "p90_us" << std::setw(10) << "p99_us"
+        << std::setw(10) << "p999_us" << std::setw(10) << "max_us"
+        << std::endl;
+    for (const auto &[command, samples] : _latency) {
+        Summary s = summarize(samples);
+        out << std::left << std::setw(12) << command << std::right
+            << std::setw(10) << s.count << std::setw(10) << s.p50
+            << std::setw(10) << s.p90 << std::setw(10) << s.p99
+            << std::setw(10) << s.p999 << std::setw(10) << s.max
+            << std::endl;
+    }
+}
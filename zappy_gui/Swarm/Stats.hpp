@@ -0,0 +1,56 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Swarm latency and tick-rate statistics
+*/
+
+#ifndef STATS_HPP_
+    #define STATS_HPP_
+    #include <cstdint>
+    #include <map>
+    #include <ostream>
+    #include <string>
+    #include <vector>
+
+class Stats {
+    public:
+        struct Summary {
+            size_t count = 0;
+            double mean = 0;
+            uint32_t p50 = 0;
+            uint32_t p90 = 0;
+            uint32_t p99 = 0;
+            uint32_t p999 = 0;
+            uint32_t max = 0;
+        };
+        struct Sample {
+            double second = 0;
+            size_t bots = 0;
+            size_t inFlight = 0;
+            double responsesPerSec = 0;
+            uint32_t p50 = 0;
+            uint32_t p99 = 0;
+            double ticksPerSec = -1;
+            int freq = 0;
+        };
+        void record(const std::string &command, uint32_t micros);
+        Sample closeInterval(double second, double elapsed);
+        void addSample(const Sample &sample);
+        void print(std::ostream &out) const;
+        bool exportFiles(const std::string &prefix) const;
+        size_t joined = 0;
+        size_t refused = 0;
+        size_t dead = 0;
+        size_t dropped = 0;
+    private:
+        static Summary summarize(std::vector<uint32_t> samples);
+        void writeLatencyCsv(std::ostream &out) const;
+        void writeTimelineCsv(std::ostream &out) const;
+        void writeJson(std::ostream &out) const;
+        std::map<std::string, std::vector<uint32_t>> _latency;
+        std::vector<uint32_t> _interval;
+        std::vector<Sample> _timeline;
+};
+
+#endif /* !STATS_HPP_ */
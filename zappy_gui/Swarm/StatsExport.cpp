@@ -0,0 +1,73 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Swarm CSV and JSON export
+*/
+
+#include "Stats.hpp"
+#include <fstream>
+
+void Stats::writeLatencyCsv(std::ostream &out) const
+{
+    out << "command,count,mean_us,p50_us,p90_us,p99_us,p999_us,max_us\n";
+    for (const auto &[command, samples] : _latency) {
+        Summary s = summarize(samples);
+        out << command << ',' << s.count << ',' << s.mean << ',' << s.p50
+            << ',' << s.p90 << ',' << s.p99 << ',' << s.p999 << ','
+            << s.max << '\n';
+    }
+}
+
+void Stats::writeTimelineCsv(std::ostream &out) const
+{
+    out << "second,bots,in_flight,responses_per_s,p50_us,p99_us,"
+        "ticks_per_s,freq\n";
+    for (const auto &s : _timeline)
+        out << s.second << ',' << s.bots << ',' << s.inFlight << ','
+            << s.responsesPerSec << ',' << s.p50 << ',' << s.p99 << ','
+            << s.ticksPerSec << ',' << s.freq << '\n';
+}
+
+void Stats::writeJson(std::ostream &out) const
+{
+    const char *sep = "";
+
+    out << "{\"bots\": {\"joined\": " << joined << ", \"refused\": "
+        << refused << ", \"dead\": " << dead << ", \"dropped\": "
+        << dropped << "},\n \"latency_us\": {";
+    for (const auto &[command, samples] : _latency) {
+        Summary s = summarize(samples);
+        out << sep << "\n  \"" << command << "\": {\"count\": " << s.count
+            << ", \"mean\": " << s.mean << ", \"p50\": " << s.p50
+            << ", \"p90\": " << s.p90 << ", \"p99\": " << s.p99
+            << ", \"p999\": " << s.p999 << ", \"max\": " << s.max << "}";
+        sep = ",";
+    }
+    out << "},\n \"timeline\": [";
+    sep = "";
+    for (const auto &s : _timeline) {
+        out << sep << "\n  {\"second\": " << s.second << ", \"bots\": "
+            << s.bots << ", \"in_flight\": " << s.inFlight
+            << ", \"responses_per_s\": " << s.responsesPerSec
+            << ", \"p50_us\": " << s.p50 << ", \"p99_us\": " << s.p99
+            << ", \"ticks_per_s\": " << s.ticksPerSec << ", \"freq\": "
+            << s.freq << "}";
+        sep = ",";
+    }
+    out << "]}\n";
+}
+
+bool Stats::exportFiles(const std::string &prefix) const
+{
+    std::ofstream latency(prefix + "_latency.csv");
+    std::ofstream timeline(prefix + "_timeline.csv");
+    std::ofstream json(prefix + ".json");
+
+    if (!latency || !timeline || !json)
+        return false;
+    writeLatencyCsv(latency);
+    writeTimelineCsv(timeline);
+    writeJson(json);
+    return static_cast<bool>(latency && timeline && json);
+}
@@ -0,0 +1,129 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Swarm
+*/
+
+#include "Swarm.hpp"
+#include <arpa/inet.h>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+/*
+** Thousands of bots need thousands of descriptors: lift the soft limit
+** as far as the hard one allows.
+*/
+static void raiseFdLimit(size_t bots)
+{
+    rlimit limit{};
+
+    if (getrlimit(RLIMIT_NOFILE, &limit) < 0 || limit.rlim_cur > bots + 16)
+        return;
+    limit.rlim_cur = std::min<rlim_t>(limit.rlim_max, bots + 16);
+    setrlimit(RLIMIT_NOFILE, &limit);
+}
+
+Swarm::Swarm(const SwarmOptions &options)
+    : _options(options), _rng(options.seed), _probe(options.adminPath)
+{
+    raiseFdLimit(options.bots);
+    _addr.sin_family = AF_INET;
+    _addr.sin_port = htons(options.port);
+    if (inet_pton(AF_INET, options.host.c_str(), &_addr.sin_addr) != 1)
+        throw std::runtime_error("Invalid server address " + options.host);
+    _epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (_epollFd < 0)
+        throw std::runtime_error("Failed to create epoll instance");
+    _bots.reserve(options.bots);
+    for (size_t i = 0; i < options.bots; i++)
+        _bots.emplace_back(options.teams[i / std::max(options.games, 1)
+            % options.teams.size()],
+            options.games > 0 ? static_cast<int>(i % options.games) : -1);
+}
+
+Swarm::~Swarm()
+{
+    for (auto &bot : _bots)
+        bot.close();
+    if (_epollFd != -1)
+        close(_epollFd);
+}
+
+/*
+** Connections are opened at a bounded rate so the listen backlog does not
+** overflow and the timeline shows where the server starts to give way.
+*/
+void Swarm::openBots(Clock::time_point now)
+{
+    double elapsed = std::chrono::duration<double>(now - _start).count();
+    size_t target = std::min(_options.bots,
+        static_cast<size_t>(_options.rate * elapsed) + 1);
+
+    for (; _opened < target; _opened++)
+        if (!_bots[_opened].open(_addr, _epollFd, _opened))
+            _stats.refused++;
+}
+
+void Swarm::handleEvents(int timeoutMs)
+{
+    epoll_event events[EVENTS];
+    Bot::Context context{*_options.mix, _options.depth, _rng, _stats};
+    int count = epoll_wait(_epollFd, events, EVENTS, timeoutMs);
+    Clock::time_point now = Clock::now();
+
+    for (int i = 0; i < count; i++) {
+        if (events[i].data.u64 == PROBE_TAG)
+            _probe.onReadable(now);
+        else
+            _bots[events[i].data.u64].onEvent(events[i].events, context, now);
+    }
+}
+
+void Swarm::sample(Clock::time_point now, double elapsed)
+{
+    double second = std::chrono::duration<double>(now - _start).count();
+    Stats::Sample sample = _stats.closeInterval(second, elapsed);
+
+    for (const auto &bot : _bots) {
+        sample.bots += bot.state() == Bot::State::Playing;
+        sample.inFlight += bot.inFlight();
+    }
+    sample.ticksPerSec = _probe.ticksPerSec();
+    sample.freq = _probe.freq();
+    _stats.addSample(sample);
+    std::cerr << "t=" << static_cast<int>(second) << "s bots " << sample.bots
+        << " replies/s " << static_cast<long>(sample.responsesPerSec)
+        << " p99 " << sample.p99 << "us ticks/s " << sample.ticksPerSec
+        << std::endl;
+    _probe.start(_epollFd, PROBE_TAG);
+}
+
+void Swarm::run(volatile std::sig_atomic_t &stop)
+{
+    Clock::time_point now = Clock::now();
+    Clock::time_point last = now;
+    auto end = now + std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(_options.seconds));
+
+    _start = now;
+    _probe.start(_epollFd, PROBE_TAG);
+    while (!stop && now < end) {
+        openBots(now);
+        handleEvents(10);
+        now = Clock::now();
+        if (now - last >= std::chrono::seconds(1)) {
+            sample(now, std::chrono::duration<double>(now - last).count());
+            last = now;
+        }
+    }
+}
+
+const Stats &Swarm::stats() const
+{
+    return _stats;
+}
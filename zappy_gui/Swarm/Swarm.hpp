@@ -0,0 +1,59 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Swarm
+*/
+
+#ifndef SWARM_HPP_
+    #define SWARM_HPP_
+    #include "AdminProbe.hpp"
+    #include "Bot.hpp"
+    #include "Mix.hpp"
+    #include "Stats.hpp"
+    #include <csignal>
+    #include <random>
+    #include <string>
+    #include <vector>
+
+struct SwarmOptions {
+    std::string host = "127.0.0.1";
+    int port = 0;
+    size_t bots = 100;
+    std::vector<std::string> teams;
+    const Mix *mix = Mix::find("default");
+    size_t depth = 1;
+    double seconds = 10;
+    double rate = 500;
+    int games = 0;
+    std::string adminPath;
+    std::string output;
+    unsigned seed = 1;
+};
+
+class Swarm {
+    public:
+        explicit Swarm(const SwarmOptions &options);
+        ~Swarm();
+        static bool parseArgs(int argc, char **argv, SwarmOptions &options);
+        void run(volatile std::sig_atomic_t &stop);
+        const Stats &stats() const;
+    private:
+        using Clock = std::chrono::steady_clock;
+        void openBots(Clock::time_point now);
+        void handleEvents(int timeoutMs);
+        void sample(Clock::time_point now, double elapsed);
+        SwarmOptions _options;
+        sockaddr_in _addr{};
+        int _epollFd = -1;
+        std::vector<Bot> _bots;
+        size_t _opened = 0;
+        std::mt19937 _rng;
+        Stats _stats;
+        AdminProbe _probe;
+        Clock::time_point _start;
+        static constexpr uint64_t PROBE_TAG = ~0ULL;
+        static constexpr int EVENTS = 256;
+};
+
+#endif /* !SWARM_HPP_ */
@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Swarm command line
+*/
+
+#include "Swarm.hpp"
+#include <cstring>
+#include <iostream>
+
+static void usage()
+{
+    std::cerr << "Usage: ./zappy_swarm -p <port> -n <team> [team ...]"
+        " [-h host] [-b bots] [-m mix] [-d depth] [-t seconds]"
+        " [-r connects/s] [-g games] [-a admin_socket] [-o prefix]"
+        " [-s seed]" << std::endl
+        << "       mixes: " << Mix::list() << std::endl;
+}
+
+static bool parseValue(const std::string &flag, const char *value,
+    SwarmOptions &options)
+{
+    if (flag == "-p")
+        options.port = std::atoi(value);
+    else if (flag == "-h")
+        options.host = value;
+    else if (flag == "-b")
+        options.bots = std::strtoul(value, nullptr, 10);
+    else if (flag == "-m")
+        options.mix = Mix::find(value);
+    else if (flag == "-d")
+        options.depth = std::strtoul(value, nullptr, 10);
+    else if (flag == "-t")
+        options.seconds = std::atof(value);
+    else if (flag == "-r")
+        options.rate = std::atof(value);
+    else if (flag == "-g")
+        options.games = std::atoi(value);
+    else if (flag == "-a")
+        options.adminPath = value;
+    else if (flag == "-o")
+        options.output = value;
+    else if (flag == "-s")
+        options.seed = std::strtoul(value, nullptr, 10);
+    else
+        return false;
+    return true;
+}
+
+static bool validate(const SwarmOptions &options)
+{
+    return options.port > 0 && options.bots > 0 && !options.teams.empty()
+        && options.mix && options.depth > 0 && options.seconds > 0
+        && options.rate > 0 && options.games >= 0;
+}
+
+bool Swarm::parseArgs(int argc, char **argv, SwarmOptions &options)
+{
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "-n") == 0) {
+            while (i + 1 < argc && argv[i + 1][0] != '-')
+                options.teams.push_back(argv[++i]);
+            continue;
+        }
+        if (i + 1 >= argc || !parseValue(argv[i], argv[i + 1], options)) {
+            usage();
+            return false;
+        }
+        i++;
+    }
+    if (!validate(options)) {
+        usage();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,40 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Swarm main
+*/
+#include <csignal>
+#include <iostream>
+#include "Swarm.hpp"
+
+static volatile std::sig_atomic_t stopRequested = 0;
+
+static void requestStop(int)
+{
+    stopRequested = 1;
+}
+
+int main(int argc, char** argv)
+{
+    SwarmOptions options;
+
+    if (!Swarm::parseArgs(argc, argv, options))
+        return 84;
+    std::signal(SIGINT, requestStop);
+    std::signal(SIGTERM, requestStop);
+    try {
+        Swarm swarm(options);
+        swarm.run(stopRequested);
+        swarm.stats().print(std::cout);
+        if (!options.output.empty()
+            && !swarm.stats().exportFiles(options.output)) {
+            std::cerr << "Error: cannot write " << options.output << std::endl;
+            return 84;
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 84;
+    }
+    return 0;
+}
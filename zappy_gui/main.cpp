@@ -13,9 +13,10 @@ int main(int argc, char** argv)
 {
     int port;
     std::string hostname;
+    std::string shmName;
     std::string msg;
 
-    if (!GuiCore::parseArgs(argc, argv, port, hostname)) {
+    if (!GuiCore::parseArgs(argc, argv, port, hostname, shmName)) {
         return 84;
     }
     try {
@@ -24,6 +25,8 @@ int main(int argc, char** argv)
         render->init(1920, 1080);
 
         GuiCore gui(std::move(network), std::move(render));
+        if (!shmName.empty())
+            gui.attachSharedWorld(shmName);
         gui.run();
     } catch (const std::exception &e) {
         std::cerr << "Error: " << e.what() << std::endl;